@@ -0,0 +1,109 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QRandomGenerator>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/AggregateProxySource.h"
+#include "datasource/ArraySource.h"
+#include "datasource/ModelSource.h"
+
+class AggregateProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testAggregation_data()
+    {
+        QTest::addColumn<AggregateProxySource::Aggregation>("aggregation");
+        QTest::addColumn<QList<double>>("expected");
+
+        QTest::newRow("mean") << AggregateProxySource::Mean << QList<double>{2.0, 5.0, 7.5};
+        QTest::newRow("minimum") << AggregateProxySource::Minimum << QList<double>{1.0, 4.0, 7.0};
+        QTest::newRow("maximum") << AggregateProxySource::Maximum << QList<double>{3.0, 6.0, 8.0};
+        QTest::newRow("sum") << AggregateProxySource::Sum << QList<double>{6.0, 15.0, 15.0};
+        QTest::newRow("count") << AggregateProxySource::Count << QList<double>{3.0, 3.0, 2.0};
+    }
+
+    void testAggregation()
+    {
+        QFETCH(AggregateProxySource::Aggregation, aggregation);
+        QFETCH(QList<double>, expected);
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(QList<double>{3.0, 1.0, 2.0, 4.0, 6.0, 5.0, 8.0, 7.0});
+
+        auto aggregate = std::make_unique<AggregateProxySource>();
+        aggregate->setBucketSize(3);
+        aggregate->setAggregation(aggregation);
+        aggregate->setSource(source.get());
+
+        // The last bucket only contains two items.
+        QCOMPARE(aggregate->itemCount(), 3);
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(aggregate->item(i), QVariant{expected.at(i)});
+        }
+        QCOMPARE(aggregate->item(3), QVariant{});
+        QCOMPARE(aggregate->minimum(), QVariant{*std::min_element(expected.cbegin(), expected.cend())});
+        QCOMPARE(aggregate->maximum(), QVariant{*std::max_element(expected.cbegin(), expected.cend())});
+    }
+
+    void testIncremental()
+    {
+        QStandardItemModel model;
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto aggregate = std::make_unique<AggregateProxySource>();
+        aggregate->setBucketSize(4);
+        aggregate->setSource(modelSource.get());
+
+        QSignalSpy insertedSpy(aggregate.get(), &AggregateProxySource::itemsInserted);
+        QSignalSpy changedSpy(aggregate.get(), &AggregateProxySource::itemsChanged);
+
+        auto compare = [&]() {
+            AggregateProxySource reference;
+            reference.setBucketSize(4);
+            reference.setSource(modelSource.get());
+
+            QCOMPARE(aggregate->itemCount(), reference.itemCount());
+            for (int item = 0; item < reference.itemCount(); ++item) {
+                QCOMPARE(aggregate->item(item), reference.item(item));
+            }
+        };
+
+        // Appending recalculates only the last buckets, which should give the
+        // same result as recalculating everything.
+        auto generator = QRandomGenerator(1);
+        for (int i = 0; i < 50; ++i) {
+            auto item = new QStandardItem;
+            item->setData(generator.bounded(100.0), Qt::DisplayRole);
+            model.appendRow(item);
+            compare();
+        }
+
+        // The first item resets, after that every fourth item adds a bucket.
+        QCOMPARE(aggregate->itemCount(), 13);
+        QCOMPARE(insertedSpy.count(), 12);
+
+        // Changing an item only recalculates its bucket.
+        changedSpy.clear();
+        model.item(21)->setData(1000.0, Qt::DisplayRole);
+        compare();
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0).at(0).toInt(), 5);
+        QCOMPARE(changedSpy.at(0).at(1).toInt(), 1);
+        QVERIFY(aggregate->maximum().toDouble() >= 250.0);
+    }
+};
+
+QTEST_GUILESS_MAIN(AggregateProxySourceTest)
+
+#include "AggregateProxySourceTest.moc"
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
  */
 
+#include <QSignalSpy>
 #include <QTest>
 
 #include "datasource/ArraySource.h"
@@ -93,6 +94,120 @@ private Q_SLOTS:
 
         QCOMPARE(source->item(itemCount * 99), firstItem);
     }
+
+    void testReadValues()
+    {
+        auto source = new ArraySource{};
+        source->setArray(QVariantList{2.5, -1, 4, 8});
+
+        // Reading a range should match converting each item, with items
+        // outside the array being read as 0.
+        QList<qreal> values(6, -100.0);
+        source->readValues(-1, 6, values.data());
+        QCOMPARE(values, (QList<qreal>{0.0, 2.5, -1.0, 4.0, 8.0, 0.0}));
+
+        // With wrap enabled, reading past the end continues at the start.
+        source->setWrap(true);
+        source->readValues(2, 4, values.data());
+        QCOMPARE(values.mid(0, 4), (QList<qreal>{4.0, 8.0, 2.5, -1.0}));
+    }
+
+    void testStatistics()
+    {
+        auto source = new ArraySource{};
+        auto revision = source->revision();
+
+        source->setArray(QVariantList{3, -2, 7, 1});
+        QVERIFY(source->revision() > revision);
+
+        auto statistics = source->statistics();
+        QCOMPARE(statistics.minimum, -2.0);
+        QCOMPARE(statistics.maximum, 7.0);
+        QCOMPARE(statistics.sum, 9.0);
+        QCOMPARE(source->minimum(), QVariant{-2});
+        QCOMPARE(source->maximum(), QVariant{7});
+
+        // Cached values should be invalidated when the data changes.
+        revision = source->revision();
+        source->setArray(QVariantList{4, 5});
+        QVERIFY(source->revision() > revision);
+
+        statistics = source->statistics();
+        QCOMPARE(statistics.minimum, 4.0);
+        QCOMPARE(statistics.maximum, 5.0);
+        QCOMPARE(statistics.sum, 9.0);
+        QCOMPARE(source->minimum(), QVariant{4});
+        QCOMPARE(source->maximum(), QVariant{5});
+    }
+
+    void testNumbers()
+    {
+        auto source = new ArraySource{};
+
+        // Numbers set as list of doubles are used as-is.
+        const QList<double> doubles{3.5, -2.0, 7.25, 1.0};
+        source->setValues(doubles);
+        QCOMPARE(source->itemCount(), 4);
+        QCOMPARE(source->item(2), QVariant{7.25});
+        QCOMPARE(source->item(4), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{-2.0});
+        QCOMPARE(source->maximum(), QVariant{7.25});
+        QCOMPARE(source->values().constData(), doubles.constData());
+        QCOMPARE(source->array(), (QVariantList{3.5, -2.0, 7.25, 1.0}));
+
+        QList<qreal> values(6, -100.0);
+        source->readValues(-1, 6, values.data());
+        QCOMPARE(values, (QList<qreal>{0.0, 3.5, -2.0, 7.25, 1.0, 0.0}));
+
+        source->setWrap(true);
+        source->readValues(3, 2, values.data());
+        QCOMPARE(values.mid(0, 2), (QList<qreal>{1.0, 3.5}));
+        source->setWrap(false);
+
+        // Floats are converted when read.
+        source->setValues(QList<float>{1.5f, 0.25f});
+        QCOMPARE(source->itemCount(), 2);
+        QCOMPARE(source->item(1), QVariant{0.25});
+        QCOMPARE(source->values(), (QList<double>{1.5, 0.25}));
+        QCOMPARE(source->minimum(), QVariant{0.25});
+        QCOMPARE(source->maximum(), QVariant{1.5});
+
+        // A buffer is interpreted according to bufferType.
+        const float floats[] = {4.0f, -1.0f, 2.0f};
+        source->setBufferType(ArraySource::Float32);
+        source->setBuffer(QByteArray::fromRawData(reinterpret_cast<const char *>(floats), sizeof(floats)));
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(0), QVariant{4.0});
+        QCOMPARE(source->minimum(), QVariant{-1.0});
+        QCOMPARE(source->maximum(), QVariant{4.0});
+        QCOMPARE(source->statistics().sum, 5.0);
+
+        // Setting an array again replaces the numbers.
+        source->setArray(QVariantList{1, 2});
+        QCOMPARE(source->itemCount(), 2);
+        QCOMPARE(source->item(0), QVariant{1});
+        QVERIFY(source->buffer().isEmpty());
+    }
+
+    void testRefillRawBuffer()
+    {
+        ArraySource source;
+        double data[] = {1.0, 2.0, 3.0};
+        const auto buffer = QByteArray::fromRawData(reinterpret_cast<const char *>(data), sizeof(data));
+        source.setBuffer(buffer);
+        QCOMPARE(source.maximum(), QVariant{3.0});
+
+        QSignalSpy dataSpy(&source, &ChartDataSource::dataChanged);
+        const auto revision = source.revision();
+
+        // Setting the same buffer after changing its memory announces the change.
+        data[1] = 9.0;
+        source.setBuffer(buffer);
+        QCOMPARE(dataSpy.count(), 1);
+        QVERIFY(source.revision() > revision);
+        QCOMPARE(source.item(1), QVariant{9.0});
+        QCOMPARE(source.maximum(), QVariant{9.0});
+    }
 };
 
 QTEST_GUILESS_MAIN(ArraySourceTest)
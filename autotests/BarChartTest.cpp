@@ -0,0 +1,76 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <vector>
+
+#include <QColor>
+#include <QTest>
+
+#include "BarChart.h"
+#include "datasource/ArraySource.h"
+#include "datasource/SpanSource.h"
+
+class BarChartTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testStackedChanges()
+    {
+        std::vector<double> first{1.0, 2.0, 3.0};
+        std::vector<double> second{1.0, 1.0, 1.0};
+        first.reserve(16);
+        second.reserve(16);
+        SpanSource<double> firstSource(first);
+        SpanSource<double> secondSource(second);
+
+        ArraySource colors;
+        colors.setArray({QColor{Qt::red}, QColor{Qt::green}});
+
+        BarChart chart;
+        chart.setWidth(100.0);
+        chart.setHeight(100.0);
+        chart.setColorSource(&colors);
+        chart.insertValueSource(0, &firstSource);
+        chart.insertValueSource(1, &secondSource);
+        chart.setStacked(true);
+
+        QCOMPARE(chart.computedRange().distanceX, 3);
+        QCOMPARE(chart.computedRange().endY, 4.0f);
+
+        // Appending adds bars without changing the maximum.
+        first.push_back(1.0);
+        firstSource.setData(first);
+        QCOMPARE(chart.computedRange().distanceX, 4);
+        QCOMPARE(chart.computedRange().endY, 4.0f);
+
+        second.push_back(1.0);
+        secondSource.setData(second);
+        QCOMPARE(chart.computedRange().distanceX, 4);
+        QCOMPARE(chart.computedRange().endY, 4.0f);
+
+        // Lowering the largest total makes the maximum smaller.
+        first[2] = 0.0;
+        firstSource.notifyChanged(2, 1);
+        QCOMPARE(chart.computedRange().endY, 3.0f);
+
+        // A total larger than the maximum makes the maximum larger.
+        second[0] = 9.0;
+        secondSource.notifyChanged(0, 1);
+        QCOMPARE(chart.computedRange().endY, 10.0f);
+
+        // Changes below the maximum keep the range.
+        first[3] = 2.0;
+        firstSource.notifyChanged(3, 1);
+        QCOMPARE(chart.computedRange().endY, 10.0f);
+        QCOMPARE(chart.computedRange().distanceX, 4);
+    }
+};
+
+QTEST_MAIN(BarChartTest)
+
+#include "BarChartTest.moc"
@@ -0,0 +1,115 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <cmath>
+
+#include <QRandomGenerator>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/DecimationProxySource.h"
+#include "datasource/ModelSource.h"
+
+class DecimationProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testPassThrough()
+    {
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(QList<double>{1.0, 5.0, 2.0, 4.0});
+
+        auto decimation = std::make_unique<DecimationProxySource>();
+        decimation->setSource(source.get());
+        decimation->setMaximumItems(10);
+
+        // Sources with fewer items than maximumItems are used as-is.
+        QCOMPARE(decimation->itemCount(), 4);
+        for (int i = 0; i < 4; ++i) {
+            QCOMPARE(decimation->item(i), source->item(i));
+            QCOMPARE(decimation->sourceIndex(i), i);
+        }
+    }
+
+    void testMinMax()
+    {
+        QList<double> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.append(std::sin(i / 10.0));
+        }
+        values[345] = 10.0;
+        values[789] = -10.0;
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        auto decimation = std::make_unique<DecimationProxySource>();
+        decimation->setMode(DecimationProxySource::MinMax);
+        decimation->setMaximumItems(100);
+        decimation->setSource(source.get());
+
+        // Peaks should always be preserved.
+        QVERIFY(decimation->itemCount() <= 100);
+        QCOMPARE(decimation->minimum(), QVariant{-10.0});
+        QCOMPARE(decimation->maximum(), QVariant{10.0});
+
+        for (int i = 1; i < decimation->itemCount(); ++i) {
+            QVERIFY(decimation->sourceIndex(i) > decimation->sourceIndex(i - 1));
+            QCOMPARE(decimation->item(i).toDouble(), values.at(decimation->sourceIndex(i)));
+        }
+    }
+
+    void testAppend_data()
+    {
+        QTest::addColumn<DecimationProxySource::Mode>("mode");
+
+        QTest::newRow("lttb") << DecimationProxySource::LargestTriangleThreeBuckets;
+        QTest::newRow("minmax") << DecimationProxySource::MinMax;
+    }
+
+    void testAppend()
+    {
+        QFETCH(DecimationProxySource::Mode, mode);
+
+        QStandardItemModel model;
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto decimation = std::make_unique<DecimationProxySource>();
+        decimation->setMode(mode);
+        decimation->setMaximumItems(20);
+        decimation->setSource(modelSource.get());
+
+        // Appending recalculates only part of the items, which should give the
+        // same result as recalculating everything.
+        auto generator = QRandomGenerator(1);
+        for (int i = 0; i < 200; ++i) {
+            auto item = new QStandardItem;
+            item->setData(generator.bounded(100.0), Qt::DisplayRole);
+            model.appendRow(item);
+
+            DecimationProxySource reference;
+            reference.setMode(mode);
+            reference.setMaximumItems(20);
+            reference.setSource(modelSource.get());
+
+            QVERIFY(decimation->itemCount() <= 20);
+            QCOMPARE(decimation->itemCount(), reference.itemCount());
+            for (int item = 0; item < reference.itemCount(); ++item) {
+                QCOMPARE(decimation->sourceIndex(item), reference.sourceIndex(item));
+                QCOMPARE(decimation->item(item), reference.item(item));
+            }
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(DecimationProxySourceTest)
+
+#include "DecimationProxySourceTest.moc"
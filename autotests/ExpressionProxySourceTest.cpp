@@ -0,0 +1,177 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/ExpressionProxySource.h"
+#include "datasource/SeriesStore.h"
+
+class ExpressionProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testExpression_data()
+    {
+        QTest::addColumn<QString>("expression");
+        QTest::addColumn<QList<double>>("expected");
+
+        QTest::newRow("sum") << QStringLiteral("a + b") << QList<double>{11.0, 22.0, 33.0};
+        QTest::newRow("precedence") << QStringLiteral("a + b * 2") << QList<double>{21.0, 42.0, 63.0};
+        QTest::newRow("parentheses") << QStringLiteral("(a + b) * 2") << QList<double>{22.0, 44.0, 66.0};
+        QTest::newRow("percentage") << QStringLiteral("a / b * 100") << QList<double>{10.0, 10.0, 10.0};
+        QTest::newRow("negate") << QStringLiteral("-a - -b") << QList<double>{9.0, 18.0, 27.0};
+        QTest::newRow("functions") << QStringLiteral("max(a, 2) + min(b, 20) - abs(-1)") << QList<double>{11.0, 21.0, 22.0};
+        QTest::newRow("constant") << QStringLiteral("2 * 3 + 1.5e1") << QList<double>{21.0, 21.0, 21.0};
+        QTest::newRow("variable") << QStringLiteral(" b ") << QList<double>{10.0, 20.0, 30.0};
+    }
+
+    void testExpression()
+    {
+        QFETCH(QString, expression);
+        QFETCH(QList<double>, expected);
+
+        ArraySource a;
+        a.setValues(QList<double>{1.0, 2.0, 3.0});
+        ArraySource b;
+        b.setValues(QList<double>{10.0, 20.0, 30.0, 40.0});
+
+        ExpressionProxySource proxy;
+        proxy.setSources({&a, &b});
+        proxy.setVariables({QStringLiteral("a"), QStringLiteral("b")});
+        proxy.setExpression(expression);
+
+        QVERIFY(proxy.errorString().isEmpty());
+        // The shortest source determines the number of items.
+        QCOMPARE(proxy.itemCount(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(proxy.item(i).toDouble(), expected.at(i));
+        }
+    }
+
+    void testInvalid_data()
+    {
+        QTest::addColumn<QString>("expression");
+
+        QTest::newRow("unknown variable") << QStringLiteral("a + c");
+        QTest::newRow("unknown function") << QStringLiteral("sqrt(a)");
+        QTest::newRow("missing operand") << QStringLiteral("a +");
+        QTest::newRow("missing parenthesis") << QStringLiteral("(a + 1");
+        QTest::newRow("trailing") << QStringLiteral("a a");
+        QTest::newRow("number") << QStringLiteral("1e");
+    }
+
+    void testInvalid()
+    {
+        QFETCH(QString, expression);
+
+        ArraySource a;
+        a.setValues(QList<double>{1.0, 2.0});
+
+        ExpressionProxySource proxy;
+        proxy.setSources({&a});
+        proxy.setVariables({QStringLiteral("a")});
+        proxy.setExpression(QStringLiteral("a"));
+        QCOMPARE(proxy.itemCount(), 2);
+
+        QSignalSpy errorSpy(&proxy, &ExpressionProxySource::errorStringChanged);
+        proxy.setExpression(expression);
+        QCOMPARE(errorSpy.count(), 1);
+        QVERIFY(!proxy.errorString().isEmpty());
+        QCOMPARE(proxy.itemCount(), 0);
+    }
+
+    void testLongInput()
+    {
+        // More items than are evaluated in one block.
+        QList<double> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.append(i);
+        }
+
+        ArraySource a;
+        a.setValues(values);
+
+        ExpressionProxySource proxy;
+        proxy.setSources({&a});
+        proxy.setVariables({QStringLiteral("x")});
+        proxy.setExpression(QStringLiteral("x * x - x"));
+
+        QCOMPARE(proxy.itemCount(), 1000);
+        QList<qreal> output(1000);
+        proxy.readValues(0, 1000, output.data());
+        for (int i = 0; i < 1000; ++i) {
+            QCOMPARE(output.at(i), qreal(i) * i - i);
+        }
+        QCOMPARE(proxy.minimum(), QVariant{0.0});
+        QCOMPARE(proxy.maximum(), QVariant{999.0 * 999.0 - 999.0});
+    }
+
+    void testIncremental()
+    {
+        SeriesStore store;
+        store.setSeriesCount(2);
+        store.appendRow({1.0, 2.0});
+        store.appendRow({3.0, 4.0});
+
+        ExpressionProxySource proxy;
+        proxy.setSources(store.series());
+        proxy.setVariables({QStringLiteral("used"), QStringLiteral("total")});
+        proxy.setExpression(QStringLiteral("used / total * 100"));
+        QCOMPARE(proxy.itemCount(), 2);
+        QCOMPARE(proxy.item(1), QVariant{75.0});
+
+        QSignalSpy dataSpy(&proxy, &ChartDataSource::dataChanged);
+        QSignalSpy insertedSpy(&proxy, &ChartDataSource::itemsInserted);
+        QSignalSpy changedSpy(&proxy, &ChartDataSource::itemsChanged);
+
+        // Both series change, but the items only change once.
+        store.appendRow({1.0, 4.0});
+        QCOMPARE(dataSpy.count(), 1);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(insertedSpy.at(0), (QVariantList{2, 1}));
+        QCOMPARE(proxy.itemCount(), 3);
+        QCOMPARE(proxy.item(2), QVariant{25.0});
+
+        store.setValue(0, 0, 2.0);
+        QCOMPARE(dataSpy.count(), 2);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0), (QVariantList{0, 1}));
+        QCOMPARE(proxy.item(0), QVariant{100.0});
+
+        store.clear();
+        QCOMPARE(proxy.itemCount(), 0);
+    }
+
+    void testDestroyedSource()
+    {
+        auto a = std::make_unique<ArraySource>();
+        a->setValues(QList<double>{1.0, 2.0});
+        ArraySource b;
+        b.setValues(QList<double>{3.0, 4.0});
+
+        ExpressionProxySource proxy;
+        proxy.setSources({a.get(), &b});
+        proxy.setVariables({QStringLiteral("a"), QStringLiteral("b")});
+        proxy.setExpression(QStringLiteral("b"));
+        QCOMPARE(proxy.itemCount(), 2);
+
+        // Sources keep their position, so b still refers to the second source.
+        a.reset();
+        QCOMPARE(proxy.itemCount(), 2);
+        QCOMPARE(proxy.item(0), QVariant{3.0});
+
+        proxy.setExpression(QStringLiteral("a + b"));
+        QCOMPARE(proxy.itemCount(), 0);
+    }
+};
+
+QTEST_GUILESS_MAIN(ExpressionProxySourceTest)
+
+#include "ExpressionProxySourceTest.moc"
@@ -0,0 +1,138 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <numeric>
+
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/HistogramSource.h"
+#include "datasource/ModelSource.h"
+
+class HistogramSourceTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QList<qreal> bins(const HistogramSource &histogram)
+    {
+        QList<qreal> result(histogram.itemCount());
+        histogram.readValues(0, result.size(), result.data());
+        return result;
+    }
+
+private Q_SLOTS:
+    void testLinear()
+    {
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(QList<double>{0.0, 1.0, 2.5, 3.0, 9.0, 10.0, 7.5, 5.0});
+
+        HistogramSource histogram;
+        histogram.setBinCount(4);
+        histogram.setSource(source.get());
+
+        // The range is determined from the items, the largest item is part of
+        // the last bin.
+        QCOMPARE(bins(histogram), (QList<qreal>{2.0, 2.0, 1.0, 3.0}));
+        QCOMPARE(histogram.binStart(1), 2.5);
+        QCOMPARE(histogram.binEnd(1), 5.0);
+        QCOMPARE(histogram.maximum(), QVariant{3.0});
+
+        // Items outside of an explicit range are not counted.
+        histogram.setAutomatic(false);
+        histogram.setFrom(2.0);
+        histogram.setTo(8.0);
+        histogram.setBinWidth(2.0);
+        QCOMPARE(bins(histogram), (QList<qreal>{2.0, 1.0, 1.0}));
+    }
+
+    void testLogarithmic()
+    {
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(QList<double>{-1.0, 0.0, 1.0, 5.0, 10.0, 50.0, 200.0, 999.0, 1000.0});
+
+        HistogramSource histogram;
+        histogram.setScale(HistogramSource::Logarithmic);
+        histogram.setBinWidth(1.0);
+        histogram.setSource(source.get());
+
+        // One bin per decade between 1 and 1000, ignoring items that are not
+        // positive.
+        QCOMPARE(bins(histogram), (QList<qreal>{2.0, 2.0, 3.0}));
+        QCOMPARE(histogram.binStart(0), 1.0);
+        QCOMPARE(histogram.binStart(2), 100.0);
+    }
+
+    void testAppend()
+    {
+        QStandardItemModel model;
+        for (auto value : {0.0, 10.0}) {
+            auto item = new QStandardItem;
+            item->setData(value, Qt::DisplayRole);
+            model.appendRow(item);
+        }
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        HistogramSource histogram;
+        histogram.setBinCount(5);
+        histogram.setSource(modelSource.get());
+        QCOMPARE(bins(histogram), (QList<qreal>{1.0, 0.0, 0.0, 0.0, 1.0}));
+
+        QSignalSpy changedSpy(&histogram, &ChartDataSource::itemsChanged);
+
+        // Items within the range are added to the existing bins.
+        auto item = new QStandardItem;
+        item->setData(5.0, Qt::DisplayRole);
+        model.appendRow(item);
+        QCOMPARE(bins(histogram), (QList<qreal>{1.0, 0.0, 1.0, 0.0, 1.0}));
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0).at(0).toInt(), 2);
+        QCOMPARE(changedSpy.at(0).at(1).toInt(), 1);
+
+        // Items outside of the range change the range.
+        item = new QStandardItem;
+        item->setData(20.0, Qt::DisplayRole);
+        model.appendRow(item);
+        QCOMPARE(bins(histogram), (QList<qreal>{1.0, 1.0, 1.0, 0.0, 1.0}));
+        QCOMPARE(histogram.binEnd(4), 20.0);
+    }
+
+    void testParallel()
+    {
+        // Enough items to be binned in parallel.
+        constexpr int count = 1 << 20;
+        QList<double> values(count);
+        for (int i = 0; i < count; ++i) {
+            values[i] = i % 100;
+        }
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        HistogramSource histogram;
+        histogram.setBinCount(10);
+        histogram.setAutomatic(false);
+        histogram.setTo(100.0);
+        histogram.setSource(source.get());
+
+        const auto result = bins(histogram);
+        QCOMPARE(result.size(), 10);
+        QCOMPARE(std::accumulate(result.cbegin(), result.cend(), 0.0), qreal(count));
+        // Values 0 to 75 occur 10486 times each, the others 10485 times.
+        QCOMPARE(result.at(0), 104860.0);
+        QCOMPARE(result.at(9), 104850.0);
+    }
+};
+
+QTEST_GUILESS_MAIN(HistogramSourceTest)
+
+#include "HistogramSourceTest.moc"
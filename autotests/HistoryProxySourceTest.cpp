@@ -4,7 +4,12 @@
  * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
  */
 
+#include <cmath>
+
+#include <QSignalSpy>
+#include <QTemporaryDir>
 #include <QTest>
+#include <QThreadPool>
 
 #include "datasource/HistoryProxySource.h"
 #include "datasource/ModelSource.h"
@@ -172,6 +177,205 @@ private Q_SLOTS:
         }
     }
 
+    void testChanges()
+    {
+        auto valueSource = std::make_unique<SingleValueSource>();
+
+        auto historySource = std::make_unique<HistoryProxySource>();
+        historySource->setSource(valueSource.get());
+        historySource->setMaximumHistory(3);
+        historySource->setFillMode(HistoryProxySource::DoNotFill);
+
+        QSignalSpy insertedSpy(historySource.get(), &ChartDataSource::itemsInserted);
+        QSignalSpy removedSpy(historySource.get(), &ChartDataSource::itemsRemoved);
+
+        // While the history is growing, new items are inserted at the start.
+        valueSource->setValue(1);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(insertedSpy.at(0), (QVariantList{0, 1}));
+        QCOMPARE(removedSpy.count(), 0);
+
+        auto change = historySource->lastChange();
+        QCOMPARE(change.start, 0);
+        QCOMPARE(change.count, 1);
+        QVERIFY(change.itemCountChanged);
+
+        valueSource->setValue(2);
+        valueSource->setValue(3);
+
+        // Once the history is full, the last item is removed as well.
+        insertedSpy.clear();
+        valueSource->setValue(4);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(removedSpy.count(), 1);
+        QCOMPARE(removedSpy.at(0), (QVariantList{3, 1}));
+
+        change = historySource->lastChange();
+        QCOMPARE(change.start, 0);
+        QCOMPARE(change.count, 3);
+        QVERIFY(!change.itemCountChanged);
+
+        // When filling from the end, only a single item changes until the
+        // history is full.
+        historySource->setMaximumHistory(5);
+        historySource->setFillMode(HistoryProxySource::FillFromEnd);
+
+        QSignalSpy changedSpy(historySource.get(), &ChartDataSource::itemsChanged);
+        valueSource->setValue(5);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0), (QVariantList{4, 1}));
+
+        change = historySource->lastChange();
+        QCOMPARE(change.start, 4);
+        QCOMPARE(change.count, 1);
+        QVERIFY(!change.itemCountChanged);
+
+        // Clearing does not describe a range, so everything is changed.
+        historySource->clear();
+        QVERIFY(historySource->lastChange().isReset());
+    }
+
+    void testMinimumMaximum()
+    {
+        auto valueSource = std::make_unique<SingleValueSource>();
+        auto historySource = std::make_unique<HistoryProxySource>();
+        historySource->setSource(valueSource.get());
+        historySource->setMaximumHistory(3);
+
+        // Minimum and maximum only consider values that are still in the
+        // history, so they change as old values drop off.
+        const QList<int> values = {5, 1, 3, 4, 6, 2, 2};
+        const QList<int> minimums = {5, 1, 1, 1, 3, 2, 2};
+        const QList<int> maximums = {5, 5, 5, 4, 6, 6, 6};
+        for (int i = 0; i < values.size(); ++i) {
+            valueSource->setValue(values.at(i));
+            QCOMPARE(historySource->minimum(), minimums.at(i));
+            QCOMPARE(historySource->maximum(), maximums.at(i));
+        }
+
+        // Reducing the maximum history drops the oldest values.
+        historySource->setMaximumHistory(1);
+        QCOMPARE(historySource->itemCount(), 1);
+        QCOMPARE(historySource->minimum(), 2);
+        QCOMPARE(historySource->maximum(), 2);
+    }
+
+    void testNonNumeric()
+    {
+        auto valueSource = std::make_unique<SingleValueSource>();
+        auto historySource = std::make_unique<HistoryProxySource>();
+        historySource->setSource(valueSource.get());
+        historySource->setMaximumHistory(3);
+
+        // Items that are not numbers, like states, are kept as they are.
+        valueSource->setValue(1);
+        valueSource->setValue(QStringLiteral("running"));
+        QCOMPARE(historySource->item(0), QVariant{QStringLiteral("running")});
+        QCOMPARE(historySource->item(1), QVariant{1});
+
+        valueSource->setValue(QStringLiteral("stopped"));
+        valueSource->setValue(QStringLiteral("running"));
+        QCOMPARE(historySource->itemCount(), 3);
+        QCOMPARE(historySource->item(0), QVariant{QStringLiteral("running")});
+        QCOMPARE(historySource->item(1), QVariant{QStringLiteral("stopped")});
+        QCOMPARE(historySource->item(2), QVariant{QStringLiteral("running")});
+        QCOMPARE(historySource->first(), QVariant{QStringLiteral("running")});
+        QCOMPARE(historySource->minimum(), QVariant{QStringLiteral("running")});
+        QCOMPARE(historySource->maximum(), QVariant{QStringLiteral("stopped")});
+
+        historySource->setMaximumHistory(1);
+        QCOMPARE(historySource->itemCount(), 1);
+        QCOMPARE(historySource->item(0), QVariant{QStringLiteral("running")});
+    }
+
+    void testCompressed()
+    {
+        auto valueSource = std::make_unique<SingleValueSource>();
+        auto historySource = std::make_unique<HistoryProxySource>();
+        historySource->setSource(valueSource.get());
+        historySource->setMaximumHistory(3000);
+        historySource->setCompressed(true);
+
+        auto uncompressedSource = std::make_unique<HistoryProxySource>();
+        uncompressedSource->setSource(valueSource.get());
+        uncompressedSource->setMaximumHistory(3000);
+
+        // Spans several blocks, with the oldest ones dropped.
+        for (int i = 0; i < 5000; ++i) {
+            valueSource->setValue(std::sin(i / 100.0) * 50.0 + (i % 7 == 0 ? 0.5 : 0.0));
+        }
+
+        QCOMPARE(historySource->itemCount(), 3000);
+        QCOMPARE(historySource->item(0), uncompressedSource->item(0));
+        QCOMPARE(historySource->item(1500), uncompressedSource->item(1500));
+        QCOMPARE(historySource->item(2999), uncompressedSource->item(2999));
+        QCOMPARE(historySource->minimum(), uncompressedSource->minimum());
+        QCOMPARE(historySource->maximum(), uncompressedSource->maximum());
+
+        QList<qreal> values(3000);
+        QList<qreal> expected(3000);
+        historySource->readValues(0, 3000, values.data());
+        uncompressedSource->readValues(0, 3000, expected.data());
+        QCOMPARE(values, expected);
+
+        // Switching back keeps the values.
+        historySource->setCompressed(false);
+        QCOMPARE(historySource->itemCount(), 3000);
+        QCOMPARE(historySource->item(2000), uncompressedSource->item(2000));
+    }
+
+    void testSnapshot()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const auto fileName = dir.filePath(qs("history"));
+
+        auto valueSource = std::make_unique<SingleValueSource>();
+
+        {
+            HistoryProxySource historySource;
+            historySource.setSource(valueSource.get());
+            historySource.setSnapshotFile(fileName);
+            for (int i = 0; i < 5; ++i) {
+                valueSource->setValue(i);
+            }
+            historySource.saveSnapshot();
+        }
+
+        // Saving happens in the background.
+        QThreadPool::globalInstance()->waitForDone();
+        QVERIFY(QFile::exists(fileName));
+
+        HistoryProxySource historySource;
+        historySource.setMaximumHistory(4);
+        historySource.setSnapshotFile(fileName);
+        historySource.setSource(valueSource.get());
+
+        // Values recorded before loading are newer than the snapshot.
+        valueSource->setValue(10);
+
+        QSignalSpy spy(&historySource, &ChartDataSource::dataChanged);
+        QVERIFY(spy.wait());
+
+        QCOMPARE(historySource.itemCount(), 4);
+        QCOMPARE(historySource.item(0), QVariant{10});
+        QCOMPARE(historySource.item(1), QVariant{4});
+        QCOMPARE(historySource.item(3), QVariant{2});
+        QCOMPARE(historySource.maximum(), QVariant{10});
+
+        // Invalid files are ignored.
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("invalid");
+        file.close();
+
+        HistoryProxySource invalidSource;
+        invalidSource.setSource(valueSource.get());
+        invalidSource.setSnapshotFile(fileName);
+        QTest::qWait(0);
+        QCOMPARE(invalidSource.itemCount(), 0);
+    }
+
     void testWithModel()
     {
         auto model = std::make_unique<TestModel>();
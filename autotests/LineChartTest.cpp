@@ -0,0 +1,155 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <vector>
+
+#include <QTest>
+#include <QVector2D>
+
+#include "LineChart.h"
+#include "RangeGroup.h"
+#include "datasource/SpanSource.h"
+#include "datasource/TimeSeriesSource.h"
+
+class TestLineChart : public LineChart
+{
+public:
+    using LineChart::calculateXValuePoints;
+    using LineChart::updatePolish;
+};
+
+class LineChartTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testXValueRange()
+    {
+        TimeSeriesSource source;
+        const std::vector<qreal> x{0.0, 4.0, 8.0, 12.0};
+        const std::vector<qreal> y{120.0, 40.0, 80.0, 10.0};
+        source.append(x, y);
+
+        TestLineChart chart;
+        chart.setWidth(100.0);
+        chart.insertValueSource(0, &source);
+        chart.xRange()->setAutomatic(false);
+        chart.xRange()->setFrom(2.0);
+        chart.xRange()->setTo(10.0);
+
+        auto range = chart.computedRange();
+        QVERIFY(range.hasXValues);
+        QCOMPARE(range.startXValue, 2.0);
+        QCOMPARE(range.endXValue, 10.0);
+        QCOMPARE(range.distanceXValue, 8.0);
+
+        // Only the items within the X range determine the Y range, so the
+        // items at 0 and 12 are ignored.
+        QCOMPARE(range.startY, 0.0f);
+        QCOMPARE(range.endY, 80.0f);
+
+        // The line crosses the edges of the range at a value interpolated
+        // between the items on either side of them.
+        auto points = chart.calculateXValuePoints(&source, range);
+        QCOMPARE(points,
+                 (QList<QVector2D>{
+                     {0.0f, 80.0f / 80.0f},
+                     {25.0f, 40.0f / 80.0f},
+                     {75.0f, 80.0f / 80.0f},
+                     {100.0f, 45.0f / 80.0f},
+                 }));
+
+        chart.setDirection(XYChart::Direction::ZeroAtEnd);
+        points = chart.calculateXValuePoints(&source, range);
+        QCOMPARE(points,
+                 (QList<QVector2D>{
+                     {0.0f, 45.0f / 80.0f},
+                     {25.0f, 80.0f / 80.0f},
+                     {75.0f, 40.0f / 80.0f},
+                     {100.0f, 80.0f / 80.0f},
+                 }));
+    }
+
+    void testXValueRangeBetweenItems()
+    {
+        TimeSeriesSource source;
+        const std::vector<qreal> x{0.0, 4.0, 8.0, 12.0};
+        const std::vector<qreal> y{120.0, 40.0, 80.0, 10.0};
+        source.append(x, y);
+
+        TestLineChart chart;
+        chart.setWidth(100.0);
+        chart.insertValueSource(0, &source);
+        chart.yRange()->setAutomatic(false);
+        chart.yRange()->setFrom(0.0);
+        chart.yRange()->setTo(100.0);
+        chart.xRange()->setAutomatic(false);
+        chart.xRange()->setFrom(5.0);
+        chart.xRange()->setTo(7.0);
+
+        // No item is within the range, but the line still crosses it.
+        const auto range = chart.computedRange();
+        const auto points = chart.calculateXValuePoints(&source, range);
+        QCOMPARE(points, (QList<QVector2D>{{0.0f, 0.5f}, {100.0f, 0.7f}}));
+
+        // Outside of all items, nothing is visible.
+        chart.xRange()->setFrom(20.0);
+        chart.xRange()->setTo(30.0);
+        QVERIFY(chart.calculateXValuePoints(&source, chart.computedRange()).isEmpty());
+    }
+
+    void testStackedChanges()
+    {
+        std::vector<double> first{1.0, 2.0, 3.0};
+        std::vector<double> second{1.0, 1.0, 1.0};
+        first.reserve(16);
+        second.reserve(16);
+        SpanSource<double> firstSource(first);
+        SpanSource<double> secondSource(second);
+
+        TestLineChart chart;
+        chart.setWidth(100.0);
+        chart.setHeight(100.0);
+        chart.insertValueSource(0, &firstSource);
+        chart.insertValueSource(1, &secondSource);
+        chart.setStacked(true);
+        chart.updatePolish();
+
+        QCOMPARE(chart.computedRange().distanceX, 3);
+        QCOMPARE(chart.computedRange().endY, 4.0f);
+
+        // Appending adds items without changing the maximum.
+        first.push_back(1.0);
+        firstSource.setData(first);
+        chart.updatePolish();
+        QCOMPARE(chart.computedRange().distanceX, 4);
+        QCOMPARE(chart.computedRange().endY, 4.0f);
+
+        // Lowering the largest total makes the maximum smaller.
+        first[2] = 0.0;
+        firstSource.notifyChanged(2, 1);
+        chart.updatePolish();
+        QCOMPARE(chart.computedRange().endY, 3.0f);
+
+        // A total larger than the maximum makes the maximum larger.
+        second[0] = 9.0;
+        secondSource.notifyChanged(0, 1);
+        chart.updatePolish();
+        QCOMPARE(chart.computedRange().endY, 10.0f);
+
+        // Changes below the maximum keep the range.
+        second.push_back(2.0);
+        secondSource.setData(second);
+        chart.updatePolish();
+        QCOMPARE(chart.computedRange().endY, 10.0f);
+        QCOMPARE(chart.computedRange().distanceX, 4);
+    }
+};
+
+QTEST_MAIN(LineChartTest)
+
+#include "LineChartTest.moc"
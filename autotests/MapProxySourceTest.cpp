@@ -5,10 +5,13 @@
  * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
  */
 
+#include <QSignalSpy>
+#include <QStandardItemModel>
 #include <QTest>
 
 #include "datasource/ArraySource.h"
 #include "datasource/MapProxySource.h"
+#include "datasource/ModelSource.h"
 
 #define qs QStringLiteral
 
@@ -81,6 +84,57 @@ private Q_SLOTS:
         QFETCH(QVariant, maximum);
         QCOMPARE(mapSource->maximum(), maximum);
     }
+
+    void testIncremental()
+    {
+        QStandardItemModel model;
+        for (auto state : {qs("idle"), qs("busy"), qs("idle")}) {
+            model.appendRow(new QStandardItem(state));
+        }
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto mapSource = std::make_unique<MapProxySource>();
+        mapSource->setMap(QVariantMap{{qs("idle"), 0.0}, {qs("busy"), 1.0}, {qs("error"), -1.0}});
+        mapSource->setSource(modelSource.get());
+
+        QList<qreal> values(3);
+        mapSource->readValues(0, 3, values.data());
+        QCOMPARE(values, (QList<qreal>{0.0, 1.0, 0.0}));
+
+        QSignalSpy changedSpy(mapSource.get(), &MapProxySource::itemsChanged);
+        QSignalSpy insertedSpy(mapSource.get(), &MapProxySource::itemsInserted);
+        QSignalSpy removedSpy(mapSource.get(), &MapProxySource::itemsRemoved);
+
+        // Changes of the source are applied and forwarded.
+        model.item(2)->setText(qs("error"));
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(mapSource->item(2), QVariant{-1.0});
+
+        model.insertRow(1, new QStandardItem(qs("busy")));
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(mapSource->itemCount(), 4);
+        QCOMPARE(mapSource->item(1), QVariant{1.0});
+        QCOMPARE(mapSource->item(3), QVariant{-1.0});
+
+        model.removeRow(0);
+        QCOMPARE(removedSpy.count(), 1);
+        QCOMPARE(mapSource->itemCount(), 3);
+        QCOMPARE(mapSource->item(0), QVariant{1.0});
+
+        // Unknown keys are not mapped.
+        model.item(0)->setText(qs("unknown"));
+        QCOMPARE(mapSource->item(0), QVariant{});
+
+        // Changing the map maps everything again.
+        mapSource->setMap(QVariantMap{{qs("unknown"), 5.0}});
+        QCOMPARE(mapSource->item(0), QVariant{5.0});
+        QCOMPARE(mapSource->item(1), QVariant{});
+        QCOMPARE(mapSource->minimum(), QVariant{5.0});
+        QCOMPARE(mapSource->maximum(), QVariant{5.0});
+    }
 };
 
 QTEST_GUILESS_MAIN(MapProxySourceTest)
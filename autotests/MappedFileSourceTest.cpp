@@ -0,0 +1,100 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QTemporaryFile>
+#include <QTest>
+#include <QtEndian>
+
+#include "datasource/MappedFileSource.h"
+
+class MappedFileSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testRaw()
+    {
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        for (auto value : {2.0, -3.5, 8.25, 1.0}) {
+            const auto littleEndian = qToLittleEndian(value);
+            file.write(reinterpret_cast<const char *>(&littleEndian), sizeof(littleEndian));
+        }
+        file.close();
+
+        MappedFileSource source;
+        QCOMPARE(source.status(), MappedFileSource::Null);
+        QCOMPARE(source.itemCount(), 0);
+
+        source.setFileName(file.fileName());
+        QTRY_COMPARE(source.status(), MappedFileSource::Ready);
+
+        QCOMPARE(source.progress(), 1.0);
+        QCOMPARE(source.itemCount(), 4);
+        QCOMPARE(source.item(2), QVariant{8.25});
+        QCOMPARE(source.item(4), QVariant{});
+        QCOMPARE(source.minimum(), QVariant{-3.5});
+        QCOMPARE(source.maximum(), QVariant{8.25});
+
+        QList<qreal> values(5, -1.0);
+        source.readValues(1, 5, values.data());
+        QCOMPARE(values, (QList<qreal>{-3.5, 8.25, 1.0, 0.0, 0.0}));
+
+        // Interpreting the same file as floats should reload it.
+        source.setValueType(MappedFileSource::Float32);
+        QTRY_COMPARE(source.status(), MappedFileSource::Ready);
+        QCOMPARE(source.itemCount(), 8);
+    }
+
+    void testHeader()
+    {
+        // Values interleaved with other data, described by a header.
+        QByteArray data(32, '\0');
+        data.replace(0, 4, "KQCS");
+        qToLittleEndian<quint32>(1, data.data() + 4);
+        qToLittleEndian<quint32>(MappedFileSource::Float32, data.data() + 8);
+        qToLittleEndian<quint32>(8, data.data() + 12);
+        qToLittleEndian<quint64>(3, data.data() + 16);
+        qToLittleEndian<quint64>(32, data.data() + 24);
+        for (auto value : {1.5f, 4.0f, -2.0f}) {
+            QByteArray entry(8, '\xff');
+            qToLittleEndian(value, entry.data());
+            data.append(entry);
+        }
+
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(data);
+        file.close();
+
+        MappedFileSource source;
+        source.setHasHeader(true);
+        source.setFileName(file.fileName());
+        QTRY_COMPARE(source.status(), MappedFileSource::Ready);
+
+        QCOMPARE(source.itemCount(), 3);
+        QCOMPARE(source.item(0), QVariant{1.5});
+        QCOMPARE(source.item(2), QVariant{-2.0});
+        QCOMPARE(source.minimum(), QVariant{-2.0});
+        QCOMPARE(source.maximum(), QVariant{4.0});
+
+        // Without header the file is not valid.
+        QTemporaryFile invalid;
+        QVERIFY(invalid.open());
+        invalid.write("invalid");
+        invalid.close();
+
+        source.setFileName(invalid.fileName());
+        QTRY_COMPARE(source.status(), MappedFileSource::Error);
+        QCOMPARE(source.itemCount(), 0);
+        QVERIFY(!source.errorString().isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(MappedFileSourceTest)
+
+#include "MappedFileSourceTest.moc"
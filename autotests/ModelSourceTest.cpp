@@ -0,0 +1,80 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ModelSource.h"
+
+class ModelSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCached_data()
+    {
+        QTest::addColumn<bool>("cached");
+
+        QTest::newRow("uncached") << false;
+        QTest::newRow("cached") << true;
+    }
+
+    void testCached()
+    {
+        QFETCH(bool, cached);
+
+        QStandardItemModel model;
+        for (auto value : {3, 1, 4}) {
+            auto item = new QStandardItem;
+            item->setData(value, Qt::DisplayRole);
+            model.appendRow(item);
+        }
+
+        ModelSource source;
+        source.setModel(&model);
+        source.setRole(Qt::DisplayRole);
+        source.setCached(cached);
+
+        auto values = [&source]() {
+            QList<qreal> result(source.itemCount());
+            source.readValues(0, result.size(), result.data());
+            return result;
+        };
+
+        QCOMPARE(values(), (QList<qreal>{3.0, 1.0, 4.0}));
+        QCOMPARE(source.item(2).toDouble(), 4.0);
+        QCOMPARE(source.minimum().toDouble(), 1.0);
+        QCOMPARE(source.maximum().toDouble(), 4.0);
+
+        // Changes to the model should be reflected, whether or not items are
+        // cached.
+        model.item(1)->setData(9, Qt::DisplayRole);
+        QCOMPARE(values(), (QList<qreal>{3.0, 9.0, 4.0}));
+        QCOMPARE(source.maximum().toDouble(), 9.0);
+
+        auto item = new QStandardItem;
+        item->setData(-2, Qt::DisplayRole);
+        model.insertRow(1, item);
+        QCOMPARE(values(), (QList<qreal>{3.0, -2.0, 9.0, 4.0}));
+        QCOMPARE(source.minimum().toDouble(), -2.0);
+
+        model.removeRows(0, 2);
+        QCOMPARE(values(), (QList<qreal>{9.0, 4.0}));
+
+        // Changing a different role should not change the items.
+        model.item(0)->setData(QStringLiteral("test"), Qt::ToolTipRole);
+        QCOMPARE(values(), (QList<qreal>{9.0, 4.0}));
+
+        model.clear();
+        QCOMPARE(source.itemCount(), 0);
+        QCOMPARE(values(), QList<qreal>{});
+    }
+};
+
+QTEST_GUILESS_MAIN(ModelSourceTest)
+
+#include "ModelSourceTest.moc"
@@ -0,0 +1,177 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QRandomGenerator>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/ModelSource.h"
+#include "datasource/MultiResolutionProxySource.h"
+
+class MultiResolutionProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testLevels()
+    {
+        QList<double> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.append(i);
+        }
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        auto proxy = std::make_unique<MultiResolutionProxySource>();
+        proxy->setMaximumItems(100);
+        proxy->setSource(source.get());
+
+        // 32 buckets of 32 items, with a minimum and maximum each.
+        QCOMPARE(proxy->bucketSize(), 32);
+        QCOMPARE(proxy->itemCount(), 64);
+        QCOMPARE(proxy->item(0), QVariant{0.0});
+        QCOMPARE(proxy->item(1), QVariant{31.0});
+        QCOMPARE(proxy->item(63), QVariant{999.0});
+        QCOMPARE(proxy->sourceIndex(2), 32);
+
+        proxy->setMode(MultiResolutionProxySource::Mean);
+        QCOMPARE(proxy->bucketSize(), 16);
+        QCOMPARE(proxy->itemCount(), 63);
+        QCOMPARE(proxy->item(0), QVariant{7.5});
+        // The last bucket only contains 8 items.
+        QCOMPARE(proxy->item(62), QVariant{995.5});
+
+        // Zooming in far enough provides the items of the source.
+        proxy->setFrom(100);
+        proxy->setTo(150);
+        QCOMPARE(proxy->bucketSize(), 1);
+        QCOMPARE(proxy->itemCount(), 50);
+        QCOMPARE(proxy->item(0), QVariant{100.0});
+        QCOMPARE(proxy->sourceIndex(49), 149);
+
+        // Buckets are aligned to their size, so a range can start in the
+        // middle of a bucket.
+        proxy->setMode(MultiResolutionProxySource::Maximum);
+        proxy->setFrom(10);
+        proxy->setTo(500);
+        QCOMPARE(proxy->bucketSize(), 8);
+        QCOMPARE(proxy->sourceIndex(0), 8);
+        QCOMPARE(proxy->item(0), QVariant{15.0});
+        QCOMPARE(proxy->minimum(), QVariant{15.0});
+        QCOMPARE(proxy->maximum(), QVariant{503.0});
+    }
+
+    void testIncremental_data()
+    {
+        QTest::addColumn<MultiResolutionProxySource::Mode>("mode");
+
+        QTest::newRow("minmax") << MultiResolutionProxySource::MinMax;
+        QTest::newRow("mean") << MultiResolutionProxySource::Mean;
+    }
+
+    void testIncremental()
+    {
+        QFETCH(MultiResolutionProxySource::Mode, mode);
+
+        QStandardItemModel model;
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto proxy = std::make_unique<MultiResolutionProxySource>();
+        proxy->setMode(mode);
+        proxy->setMaximumItems(20);
+        proxy->setSource(modelSource.get());
+
+        auto compare = [&]() {
+            MultiResolutionProxySource reference;
+            reference.setMode(mode);
+            reference.setMaximumItems(20);
+            reference.setSource(modelSource.get());
+
+            QCOMPARE(proxy->bucketSize(), reference.bucketSize());
+            QCOMPARE(proxy->itemCount(), reference.itemCount());
+            for (int item = 0; item < reference.itemCount(); ++item) {
+                QCOMPARE(proxy->item(item), reference.item(item));
+            }
+        };
+
+        // Appending and changing items only updates part of the index, which
+        // should give the same result as building it again.
+        auto generator = QRandomGenerator(1);
+        for (int i = 0; i < 200; ++i) {
+            auto item = new QStandardItem;
+            item->setData(generator.bounded(100.0), Qt::DisplayRole);
+            model.appendRow(item);
+            compare();
+
+            if (i % 10 == 0) {
+                model.item(generator.bounded(i + 1))->setData(generator.bounded(100.0), Qt::DisplayRole);
+                compare();
+            }
+        }
+    }
+
+    void testBackground()
+    {
+        QList<double> values(1 << 20, 1.0);
+        values[12345] = 5.0;
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        auto proxy = std::make_unique<MultiResolutionProxySource>();
+        proxy->setMaximumItems(200);
+        proxy->setSource(source.get());
+
+        // The index of large sources is built on a separate thread. Until it is
+        // done, the first item of each bucket is shown.
+        QCOMPARE(proxy->itemCount(), 128);
+        QCOMPARE(proxy->bucketSize(), 1 << 14);
+        QTRY_COMPARE(proxy->maximum(), QVariant{5.0});
+        QCOMPARE(proxy->itemCount(), 128);
+        QCOMPARE(proxy->minimum(), QVariant{1.0});
+    }
+
+    void testChangeWhileBuilding()
+    {
+        QList<double> values(1 << 20, 1.0);
+        values[12345] = 5.0;
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        auto proxy = std::make_unique<MultiResolutionProxySource>();
+        proxy->setMaximumItems(200);
+        proxy->setSource(source.get());
+        QCOMPARE(proxy->itemCount(), 128);
+
+        // Changes while the index is being built do not clear the items and
+        // result in a single new build with the final items.
+        for (int i = 0; i < 20; ++i) {
+            values[12345 + i] = 1.0;
+            values[12346 + i] = 7.0 + i;
+            source->setValues(values);
+            QCOMPARE(proxy->itemCount(), 128);
+        }
+
+        QTRY_COMPARE(proxy->maximum(), QVariant{26.0});
+        QCOMPARE(proxy->itemCount(), 128);
+        QCOMPARE(proxy->item(1), QVariant{26.0});
+
+        // Destroying the proxy while building is safe.
+        source->setValues(QList<double>(1 << 20, 2.0));
+        proxy.reset();
+        QTest::qWait(50);
+    }
+};
+
+QTEST_GUILESS_MAIN(MultiResolutionProxySourceTest)
+
+#include "MultiResolutionProxySourceTest.moc"
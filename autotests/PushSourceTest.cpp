@@ -0,0 +1,86 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+#include <QThread>
+
+#include "datasource/PushSource.h"
+
+class PushSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testPush()
+    {
+        PushSource source;
+        source.setMaximumHistory(5);
+        QSignalSpy spy(&source, &ChartDataSource::dataChanged);
+
+        const std::vector<qreal> values{1.0, 2.0, 3.0};
+        QCOMPARE(source.push(values), qsizetype(3));
+        QVERIFY(source.push(4.0));
+
+        // Values are only added once the queue is drained, with a single
+        // change for all of them.
+        QCOMPARE(source.itemCount(), 0);
+        QVERIFY(spy.wait());
+        QCOMPARE(spy.count(), 1);
+        QCOMPARE(source.itemCount(), 4);
+        QCOMPARE(source.item(0), QVariant{4.0});
+        QCOMPARE(source.item(3), QVariant{1.0});
+        QCOMPARE(source.maximum(), QVariant{4.0});
+        QCOMPARE(source.lastChange().start, 0);
+        QVERIFY(source.lastChange().itemCountChanged);
+    }
+
+    void testQueueFull()
+    {
+        PushSource source;
+        source.setQueueSize(4);
+        QCOMPARE(source.queueSize(), 4);
+
+        const std::vector<qreal> values{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        QCOMPARE(source.push(values), qsizetype(4));
+        QVERIFY(!source.push(7.0));
+
+        QTRY_COMPARE(source.itemCount(), 4);
+        QCOMPARE(source.item(0), QVariant{4.0});
+    }
+
+    void testThread()
+    {
+        PushSource source;
+        source.setMaximumHistory(100000);
+
+        constexpr int count = 100000;
+        auto thread = QThread::create([&source]() {
+            for (int i = 0; i < count;) {
+                if (source.push(qreal(i))) {
+                    ++i;
+                }
+            }
+        });
+        thread->start();
+
+        // All values should arrive, in order.
+        QTRY_COMPARE_WITH_TIMEOUT(source.itemCount(), count, 10000);
+        QVERIFY(thread->wait());
+        delete thread;
+
+        QList<qreal> values(count);
+        source.readValues(0, count, values.data());
+        for (int i = 0; i < count; ++i) {
+            QCOMPARE(values.at(i), qreal(count - i - 1));
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(PushSourceTest)
+
+#include "PushSourceTest.moc"
@@ -0,0 +1,108 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QRandomGenerator>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/ModelSource.h"
+#include "datasource/QuantileProxySource.h"
+
+class QuantileProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testQuantiles()
+    {
+        // Two buckets containing 1 to 1000 and 1001 to 2000, shuffled.
+        QList<double> values;
+        for (int bucket = 0; bucket < 2; ++bucket) {
+            QList<double> bucketValues;
+            for (int i = 1; i <= 1000; ++i) {
+                bucketValues.append(bucket * 1000 + i);
+            }
+            std::shuffle(bucketValues.begin(), bucketValues.end(), *QRandomGenerator::global());
+            values.append(bucketValues);
+        }
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(values);
+
+        auto proxy = std::make_unique<QuantileProxySource>();
+        proxy->setBucketSize(1000);
+        proxy->setSource(source.get());
+
+        const auto series = proxy->series();
+        QCOMPARE(series.size(), 3);
+        QCOMPARE(proxy->itemCount(), 2);
+
+        auto compare = [](const QVariant &actual, qreal expected) {
+            return std::abs(actual.toDouble() - expected) <= expected * 0.01;
+        };
+
+        QVERIFY(compare(proxy->item(0), 500.0));
+        QVERIFY(compare(series.at(0)->item(1), 1500.0));
+        QVERIFY(compare(series.at(1)->item(0), 950.0));
+        QVERIFY(compare(series.at(2)->item(0), 990.0));
+        QVERIFY(compare(series.at(2)->item(1), 1990.0));
+        QVERIFY(compare(series.at(2)->maximum(), 1990.0));
+
+        QVERIFY(compare(proxy->totalQuantile(0.5), 1000.0));
+        QVERIFY(compare(proxy->totalQuantile(0.99), 1980.0));
+
+        proxy->setQuantiles({0.1});
+        QCOMPARE(proxy->series().size(), 1);
+        QCOMPARE(proxy->series().at(0)->itemCount(), 2);
+        QVERIFY(compare(proxy->item(1), 1100.0));
+    }
+
+    void testAppend()
+    {
+        QStandardItemModel model;
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto proxy = std::make_unique<QuantileProxySource>();
+        proxy->setBucketSize(10);
+        proxy->setQuantiles({0.5, 0.9});
+        proxy->setSource(modelSource.get());
+
+        QSignalSpy insertedSpy(proxy->series().at(1), &ChartDataSource::itemsInserted);
+
+        // Appending only updates the last bucket, which should give the same
+        // result as recalculating everything.
+        auto generator = QRandomGenerator(1);
+        for (int i = 0; i < 45; ++i) {
+            auto item = new QStandardItem;
+            item->setData(generator.bounded(100.0), Qt::DisplayRole);
+            model.appendRow(item);
+
+            QuantileProxySource reference;
+            reference.setBucketSize(10);
+            reference.setQuantiles({0.5, 0.9});
+            reference.setSource(modelSource.get());
+
+            QCOMPARE(proxy->itemCount(), reference.itemCount());
+            for (int index = 0; index < reference.itemCount(); ++index) {
+                QCOMPARE(proxy->series().at(0)->item(index), reference.series().at(0)->item(index));
+                QCOMPARE(proxy->series().at(1)->item(index), reference.series().at(1)->item(index));
+            }
+        }
+
+        // The first item resets, after that every tenth item adds a bucket.
+        QCOMPARE(proxy->itemCount(), 5);
+        QCOMPARE(insertedSpy.count(), 4);
+    }
+};
+
+QTEST_GUILESS_MAIN(QuantileProxySourceTest)
+
+#include "QuantileProxySourceTest.moc"
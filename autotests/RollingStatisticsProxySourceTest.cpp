@@ -0,0 +1,112 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <cmath>
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/PushSource.h"
+#include "datasource/RollingStatisticsProxySource.h"
+
+class RollingStatisticsProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testStatistics_data()
+    {
+        QTest::addColumn<RollingStatisticsProxySource::Statistic>("statistic");
+        QTest::addColumn<QList<double>>("expected");
+
+        QTest::newRow("mean") << RollingStatisticsProxySource::Mean << QList<double>{1.0, 1.5, 2.0, 3.0, 13.0 / 3.0};
+        QTest::newRow("exponential") << RollingStatisticsProxySource::ExponentialMean << QList<double>{1.0, 1.5, 2.25, 3.125, 4.5625};
+        QTest::newRow("deviation") << RollingStatisticsProxySource::StandardDeviation
+                                   << QList<double>{0.0, 0.5, std::sqrt(2.0 / 3.0), std::sqrt(2.0 / 3.0), std::sqrt(14.0 / 9.0)};
+        QTest::newRow("minimum") << RollingStatisticsProxySource::Minimum << QList<double>{1.0, 1.0, 1.0, 2.0, 3.0};
+        QTest::newRow("maximum") << RollingStatisticsProxySource::Maximum << QList<double>{1.0, 2.0, 3.0, 4.0, 6.0};
+    }
+
+    void testStatistics()
+    {
+        QFETCH(RollingStatisticsProxySource::Statistic, statistic);
+        QFETCH(QList<double>, expected);
+
+        auto source = std::make_unique<ArraySource>();
+        source->setValues(QList<double>{1.0, 2.0, 3.0, 4.0, 6.0});
+
+        auto proxy = std::make_unique<RollingStatisticsProxySource>();
+        proxy->setWindow(3);
+        proxy->setStatistic(statistic);
+        proxy->setSource(source.get());
+
+        QCOMPARE(proxy->itemCount(), 5);
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(proxy->item(i).toDouble(), expected.at(i));
+        }
+
+        // The bands are the mean plus and minus two standard deviations.
+        QCOMPARE(proxy->upperBand()->itemCount(), 5);
+        QCOMPARE(proxy->upperBand()->item(1).toDouble(), 2.5);
+        QCOMPARE(proxy->lowerBand()->item(1).toDouble(), 0.5);
+    }
+
+    void testIncremental()
+    {
+        PushSource source;
+        source.setMaximumHistory(8);
+
+        RollingStatisticsProxySource proxy;
+        proxy.setWindow(4);
+        proxy.setNewestFirst(true);
+        proxy.setSource(&source);
+
+        QSignalSpy insertedSpy(&proxy, &ChartDataSource::itemsInserted);
+        QSignalSpy removedSpy(proxy.lowerBand(), &ChartDataSource::itemsRemoved);
+
+        auto push = [&source](std::vector<qreal> values) {
+            QSignalSpy spy(&source, &ChartDataSource::dataChanged);
+            source.push(values);
+            QVERIFY(spy.wait());
+        };
+
+        // New items are calculated from the items before them, which should
+        // give the same result as calculating everything.
+        push({5.0, 1.0, 4.0});
+        push({2.0, 8.0});
+        QCOMPARE(insertedSpy.count(), 2);
+        QCOMPARE(insertedSpy.at(1).at(0).toInt(), 0);
+        QCOMPARE(insertedSpy.at(1).at(1).toInt(), 2);
+
+        {
+            RollingStatisticsProxySource reference;
+            reference.setWindow(4);
+            reference.setNewestFirst(true);
+            reference.setSource(&source);
+            QCOMPARE(proxy.itemCount(), 5);
+            for (int i = 0; i < 5; ++i) {
+                QCOMPARE(proxy.item(i), reference.item(i));
+                QCOMPARE(proxy.upperBand()->item(i), reference.upperBand()->item(i));
+            }
+        }
+
+        // Items dropping out of the history are removed, the statistics of the
+        // newest item still include those.
+        push({3.0, 7.0, 6.0, 9.0});
+        QCOMPARE(proxy.itemCount(), 8);
+        QCOMPARE(removedSpy.count(), 1);
+        QCOMPARE(removedSpy.at(0).at(0).toInt(), 8);
+        QCOMPARE(removedSpy.at(0).at(1).toInt(), 1);
+        QCOMPARE(proxy.item(0).toDouble(), (7.0 + 6.0 + 9.0 + 3.0) / 4.0);
+        QCOMPARE(proxy.item(7).toDouble(), 3.0);
+    }
+};
+
+QTEST_GUILESS_MAIN(RollingStatisticsProxySourceTest)
+
+#include "RollingStatisticsProxySourceTest.moc"
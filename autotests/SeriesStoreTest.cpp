@@ -0,0 +1,113 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/SeriesStore.h"
+
+class SeriesStoreTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testAppend()
+    {
+        SeriesStore store;
+        store.setSeriesCount(3);
+        QCOMPARE(store.series().size(), 3);
+
+        auto series = store.series();
+        QSignalSpy changedSpy(&store, &SeriesStore::changed);
+        QSignalSpy dataSpy(series.at(1), &ChartDataSource::dataChanged);
+        QSignalSpy insertedSpy(series.at(1), &ChartDataSource::itemsInserted);
+
+        store.appendRow({1.0, 2.0, 3.0});
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(store.itemCount(), 1);
+
+        // Rows are stored per series.
+        const std::vector<qreal> rows{4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+        store.appendRows(rows);
+        QCOMPARE(changedSpy.count(), 2);
+        QCOMPARE(dataSpy.count(), 2);
+        QCOMPARE(insertedSpy.last(), (QVariantList{1, 2}));
+
+        QCOMPARE(store.itemCount(), 3);
+        QCOMPARE(series.at(0)->item(1), QVariant{4.0});
+        QCOMPARE(series.at(2)->item(2), QVariant{9.0});
+        QCOMPARE(series.at(1)->maximum(), QVariant{8.0});
+        QCOMPARE(series.at(1)->lastChange().start, 1);
+        QVERIFY(series.at(1)->lastChange().itemCountChanged);
+
+        auto column = store.column(1);
+        QCOMPARE(column[0], 2.0);
+        QCOMPARE(column[2], 8.0);
+
+        QList<qreal> values(4, -1.0);
+        series.at(2)->readValues(1, 4, values.data());
+        QCOMPARE(values, (QList<qreal>{6.0, 9.0, 0.0, 0.0}));
+    }
+
+    void testBatch()
+    {
+        SeriesStore store;
+        store.setSeriesCount(2);
+        store.appendRow({1.0, 1.0});
+
+        auto series = store.series();
+        QSignalSpy changedSpy(&store, &SeriesStore::changed);
+        QSignalSpy dataSpy(series.at(0), &ChartDataSource::dataChanged);
+
+        store.beginBatch();
+        store.setValue(1, 0, 5.0);
+        store.beginBatch();
+        store.appendRow({2.0});
+        store.appendRow({3.0, 4.0});
+        store.endBatch();
+        QCOMPARE(changedSpy.count(), 0);
+        store.endBatch();
+
+        // All changes are announced once, for all series.
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(dataSpy.count(), 1);
+        QCOMPARE(store.itemCount(), 3);
+        QCOMPARE(series.at(1)->item(0), QVariant{5.0});
+        QCOMPARE(series.at(1)->item(1), QVariant{0.0});
+        QCOMPARE(series.at(0)->lastChange().start, 0);
+        QCOMPARE(series.at(0)->lastChange().count, 3);
+
+        store.clear();
+        QCOMPARE(changedSpy.count(), 2);
+        QCOMPARE(store.itemCount(), 0);
+        QVERIFY(series.at(0)->lastChange().isReset());
+    }
+
+    void testSeriesCount()
+    {
+        SeriesStore store;
+        store.setSeriesCount(2);
+        store.appendRow({1.0, 2.0});
+
+        auto first = store.series().at(0);
+        QSignalSpy destroyedSpy(store.series().at(1), &QObject::destroyed);
+
+        store.setSeriesCount(1);
+        QCOMPARE(destroyedSpy.count(), 1);
+        QCOMPARE(store.series().at(0), first);
+
+        store.setSeriesCount(3);
+        QCOMPARE(store.series().size(), 3);
+        QCOMPARE(store.series().at(2)->itemCount(), 1);
+        QCOMPARE(store.series().at(2)->item(0), QVariant{0.0});
+        QCOMPARE(store.column(3), nullptr);
+    }
+};
+
+QTEST_GUILESS_MAIN(SeriesStoreTest)
+
+#include "SeriesStoreTest.moc"
@@ -0,0 +1,117 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <atomic>
+
+#include <QCoreApplication>
+#include <QSharedMemory>
+#include <QTest>
+
+#include "datasource/SharedMemorySource.h"
+#include "datasource/SharedMemoryWriter.h"
+
+class SharedMemorySourceTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QString segmentName(const char *suffix) const
+    {
+        return QStringLiteral("kquickcharts-test-%1-%2").arg(QCoreApplication::applicationPid()).arg(QLatin1String(suffix));
+    }
+
+private Q_SLOTS:
+    void testRead()
+    {
+        const auto name = segmentName("read");
+
+        SharedMemoryWriter writer;
+        if (!writer.create(name, 4)) {
+            QSKIP(qPrintable(QStringLiteral("Shared memory is not available: %1").arg(writer.errorString())));
+        }
+
+        // Values already written should be read when attaching.
+        writer.write(std::vector<qreal>{1.0, 2.0});
+
+        SharedMemorySource source;
+        source.setMaximumHistory(5);
+        QCOMPARE(source.status(), SharedMemorySource::Null);
+
+        source.setName(name);
+        QTRY_COMPARE(source.status(), SharedMemorySource::Attached);
+        QCOMPARE(source.itemCount(), 2);
+        QCOMPARE(source.item(0), QVariant{2.0});
+        QCOMPARE(source.item(1), QVariant{1.0});
+
+        writer.write(3.0);
+        QTRY_COMPARE(source.itemCount(), 3);
+        QCOMPARE(source.item(0), QVariant{3.0});
+
+        // Values that were overwritten before reading them are lost, as is
+        // the oldest value in the ring buffer since the writer could be
+        // replacing it.
+        writer.write(std::vector<qreal>{4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+        QTRY_COMPARE(source.item(0), QVariant{9.0});
+        QCOMPARE(source.itemCount(), 5);
+        QCOMPARE(source.item(1), QVariant{8.0});
+        QCOMPARE(source.item(2), QVariant{7.0});
+        QCOMPARE(source.item(3), QVariant{3.0});
+        QCOMPARE(source.item(4), QVariant{2.0});
+        QCOMPARE(source.minimum(), QVariant{2.0});
+        QCOMPARE(source.maximum(), QVariant{9.0});
+    }
+
+    void testWaiting()
+    {
+        const auto name = segmentName("waiting");
+
+        SharedMemorySource source;
+        source.setName(name);
+        QTRY_COMPARE(source.status(), SharedMemorySource::Waiting);
+
+        SharedMemoryWriter writer;
+        if (!writer.create(name, 16, SharedMemorySource::Float32)) {
+            QSKIP(qPrintable(QStringLiteral("Shared memory is not available: %1").arg(writer.errorString())));
+        }
+        writer.write(1.5);
+
+        QTRY_COMPARE_WITH_TIMEOUT(source.status(), SharedMemorySource::Attached, 5000);
+        QTRY_COMPARE(source.itemCount(), 1);
+        QCOMPARE(source.item(0), QVariant{1.5});
+    }
+
+    void testHeaderNotReady()
+    {
+        const auto name = segmentName("not-ready");
+
+        // A segment that exists but whose header has not been written yet,
+        // like right after the writer created it.
+        QSharedMemory memory(SharedMemorySource::nativeKey(name));
+        if (!memory.create(sizeof(SharedMemorySource::Header) + 4 * sizeof(double))) {
+            QSKIP(qPrintable(QStringLiteral("Shared memory is not available: %1").arg(memory.errorString())));
+        }
+
+        SharedMemorySource source;
+        source.setName(name);
+        QTRY_COMPARE(source.status(), SharedMemorySource::Waiting);
+
+        auto header = static_cast<SharedMemorySource::Header *>(memory.data());
+        header->version = SharedMemorySource::Version;
+        header->valueType = SharedMemorySource::Float64;
+        QTest::qWait(1500);
+        QCOMPARE(source.status(), SharedMemorySource::Waiting);
+
+        header->capacity = 4;
+        std::atomic_ref<quint32>(header->magic).store(SharedMemorySource::Magic, std::memory_order_release);
+        QTRY_COMPARE_WITH_TIMEOUT(source.status(), SharedMemorySource::Attached, 5000);
+        QCOMPARE(source.itemCount(), 0);
+    }
+};
+
+QTEST_GUILESS_MAIN(SharedMemorySourceTest)
+
+#include "SharedMemorySourceTest.moc"
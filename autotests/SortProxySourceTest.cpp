@@ -0,0 +1,86 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/SortProxySource.h"
+
+class SortProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testSynchronous()
+    {
+        ArraySource source;
+        source.setArray({3.0, 1.0, 2.0});
+
+        SortProxySource proxy;
+        proxy.setAsynchronous(false);
+        proxy.setSource(&source);
+
+        QCOMPARE(proxy.itemCount(), 3);
+        QCOMPARE(proxy.item(0), QVariant{1.0});
+        QCOMPARE(proxy.item(2), QVariant{3.0});
+        QCOMPARE(proxy.minimum(), QVariant{1.0});
+        QCOMPARE(proxy.maximum(), QVariant{3.0});
+
+        proxy.setSortOrder(Qt::DescendingOrder);
+        QList<qreal> values(4, -1.0);
+        proxy.readValues(0, 4, values.data());
+        QCOMPARE(values, (QList<qreal>{3.0, 2.0, 1.0, 0.0}));
+    }
+
+    void testAsynchronous()
+    {
+        ArraySource source;
+        QVariantList array;
+        for (int i = 0; i < 100000; ++i) {
+            array.append(qreal((i * 7919) % 100000));
+        }
+        source.setArray(array);
+
+        SortProxySource proxy;
+        QSignalSpy busySpy(&proxy, &AsyncProxySource::busyChanged);
+        QSignalSpy dataSpy(&proxy, &ChartDataSource::dataChanged);
+        proxy.setSource(&source);
+
+        // Nothing is calculated until the event loop runs.
+        QCOMPARE(proxy.itemCount(), 0);
+        QVERIFY(!proxy.busy());
+
+        QTRY_COMPARE(dataSpy.count(), 1);
+        QVERIFY(!proxy.busy());
+        QCOMPARE(busySpy.count(), 2);
+        QCOMPARE(proxy.itemCount(), 100000);
+        QCOMPARE(proxy.item(0), QVariant{0.0});
+        QCOMPARE(proxy.item(99999), QVariant{99999.0});
+
+        // The previous result stays visible until the new one is done, and
+        // several changes result in a single new result.
+        proxy.setSortOrder(Qt::DescendingOrder);
+        source.setArray({5.0, 6.0});
+        QCOMPARE(proxy.itemCount(), 100000);
+        QTRY_COMPARE(dataSpy.count(), 2);
+        QCOMPARE(proxy.itemCount(), 2);
+        QCOMPARE(proxy.item(0), QVariant{6.0});
+
+        // Destroying the proxy while it is calculating discards the result.
+        {
+            SortProxySource other;
+            other.setSource(&source);
+            QTest::qWait(0);
+        }
+        QTest::qWait(10);
+    }
+};
+
+QTEST_GUILESS_MAIN(SortProxySourceTest)
+
+#include "SortProxySourceTest.moc"
@@ -0,0 +1,99 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <vector>
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/SpanSource.h"
+
+class SpanSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testDouble()
+    {
+        std::vector<double> values{3.0, 1.0, 4.0, 1.5};
+        SpanSource<double> source(values);
+
+        QCOMPARE(source.itemCount(), 4);
+        QCOMPARE(source.item(2), QVariant{4.0});
+        QCOMPARE(source.item(4), QVariant{});
+        QCOMPARE(source.minimum(), QVariant{1.0});
+        QCOMPARE(source.maximum(), QVariant{4.0});
+
+        QList<qreal> output(6, -1.0);
+        source.readValues(-1, 6, output.data());
+        QCOMPARE(output, (QList<qreal>{0.0, 3.0, 1.0, 4.0, 1.5, 0.0}));
+
+        QSignalSpy dataSpy(&source, &ChartDataSource::dataChanged);
+        QSignalSpy changedSpy(&source, &ChartDataSource::itemsChanged);
+
+        values[1] = 9.0;
+        source.notifyChanged(1, 1);
+        QCOMPARE(dataSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0), (QVariantList{1, 1}));
+        QCOMPARE(source.maximum(), QVariant{9.0});
+
+        // Ranges are limited to the buffer.
+        source.notifyChanged(3, 10);
+        QCOMPARE(changedSpy.at(1), (QVariantList{3, 1}));
+        source.notifyChanged(4, 1);
+        QCOMPARE(dataSpy.count(), 2);
+
+        source.notifyChanged();
+        QCOMPARE(dataSpy.count(), 3);
+        QVERIFY(source.lastChange().isReset());
+    }
+
+    void testFloat()
+    {
+        const float values[] = {0.5f, -2.0f, 8.0f};
+        SpanSource<float> source(values);
+
+        QCOMPARE(source.itemCount(), 3);
+        QCOMPARE(source.item(1), QVariant{-2.0});
+        QCOMPARE(source.minimum(), QVariant{-2.0});
+        QCOMPARE(source.maximum(), QVariant{8.0});
+
+        QList<qreal> output(3);
+        source.readValues(0, 3, output.data());
+        QCOMPARE(output, (QList<qreal>{0.5, -2.0, 8.0}));
+    }
+
+    void testSetData()
+    {
+        std::vector<int> values{1, 2, 3, 4, 5};
+        SpanSource<int> source(std::span<const int>(values).first(3));
+        QCOMPARE(source.itemCount(), 3);
+        QCOMPARE(source.maximum(), QVariant{3.0});
+
+        QSignalSpy dataSpy(&source, &ChartDataSource::dataChanged);
+        QSignalSpy insertedSpy(&source, &ChartDataSource::itemsInserted);
+
+        // Growing the same buffer is an append.
+        source.setData(values);
+        QCOMPARE(dataSpy.count(), 1);
+        QCOMPARE(insertedSpy.at(0), (QVariantList{3, 2}));
+        QCOMPARE(source.itemCount(), 5);
+        QCOMPARE(source.maximum(), QVariant{5.0});
+
+        // A different buffer replaces everything.
+        std::vector<int> other{7};
+        source.setData(other);
+        QCOMPARE(dataSpy.count(), 2);
+        QCOMPARE(insertedSpy.count(), 1);
+        QVERIFY(source.lastChange().isReset());
+        QCOMPARE(source.item(0), QVariant{7.0});
+    }
+};
+
+QTEST_GUILESS_MAIN(SpanSourceTest)
+
+#include "SpanSourceTest.moc"
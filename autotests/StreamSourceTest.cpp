@@ -0,0 +1,141 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <QTest>
+#include <QtEndian>
+
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+#include "datasource/StreamSource.h"
+
+class StreamSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCsv()
+    {
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write("time;value\r\n1;2.5\r\n2; 3.5\r\n3;invalid\r\n4;-1");
+        file.close();
+
+        StreamSource source;
+        source.setSeparator(QStringLiteral(";"));
+        source.setColumn(1);
+        source.setFileName(file.fileName());
+        QTRY_COMPARE(source.status(), StreamSource::Finished);
+
+        // Lines without a number are skipped and the most recent value is
+        // the first item.
+        QCOMPARE(source.itemCount(), 3);
+        QCOMPARE(source.item(0), QVariant{-1.0});
+        QCOMPARE(source.item(1), QVariant{3.5});
+        QCOMPARE(source.item(2), QVariant{2.5});
+        QCOMPARE(source.minimum(), QVariant{-1.0});
+        QCOMPARE(source.maximum(), QVariant{3.5});
+
+        // Only the most recent values are kept.
+        source.setMaximumHistory(2);
+        QCOMPARE(source.itemCount(), 2);
+        QCOMPARE(source.item(1), QVariant{3.5});
+
+        source.setMaximumHistory(5);
+        source.setFillMode(HistoryProxySource::FillFromEnd);
+        QCOMPARE(source.itemCount(), 5);
+        QCOMPARE(source.item(0), QVariant{0.0});
+        QCOMPARE(source.item(3), QVariant{-1.0});
+        QCOMPARE(source.item(4), QVariant{3.5});
+    }
+
+    void testBinary()
+    {
+        // Frames of two floats, of which the second is used.
+        QByteArray data;
+        for (auto value : {1.0f, 10.0f, 2.0f, 20.0f, 3.0f, 30.0f}) {
+            const auto littleEndian = qToLittleEndian(value);
+            data.append(reinterpret_cast<const char *>(&littleEndian), sizeof(littleEndian));
+        }
+        // An incomplete frame at the end is ignored.
+        data.append("\0\0", 2);
+
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(data);
+        file.close();
+
+        StreamSource source;
+        source.setFormat(StreamSource::Binary);
+        source.setValueType(StreamSource::Float32);
+        source.setColumnCount(2);
+        source.setColumn(1);
+        source.setFileName(file.fileName());
+        QTRY_COMPARE(source.status(), StreamSource::Finished);
+
+        QCOMPARE(source.itemCount(), 3);
+        QList<qreal> values(3);
+        source.readValues(0, 3, values.data());
+        QCOMPARE(values, (QList<qreal>{30.0, 20.0, 10.0}));
+    }
+
+    void testError()
+    {
+        StreamSource source;
+        source.setFileName(QStringLiteral("/does/not/exist"));
+        QTRY_COMPARE(source.status(), StreamSource::Error);
+        QVERIFY(!source.errorString().isEmpty());
+        QCOMPARE(source.itemCount(), 0);
+    }
+
+    void testCancelWaitingReader()
+    {
+#ifdef Q_OS_UNIX
+        QTemporaryDir directory;
+        QVERIFY(directory.isValid());
+        const auto fifoName = directory.filePath(QStringLiteral("fifo"));
+        QCOMPARE(::mkfifo(QFile::encodeName(fifoName).constData(), 0600), 0);
+
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write("1\n2\n");
+        file.close();
+
+        QElapsedTimer timer;
+        timer.start();
+
+        // A named pipe without a writer blocks reading. Changing the file
+        // stops that reader and starts a new one.
+        auto source = std::make_unique<StreamSource>();
+        source->setFileName(fifoName);
+        QTRY_COMPARE(source->status(), StreamSource::Active);
+        QTest::qWait(200);
+        QCOMPARE(source->status(), StreamSource::Active);
+
+        source->setFileName(file.fileName());
+        QTRY_COMPARE(source->status(), StreamSource::Finished);
+        QCOMPARE(source->itemCount(), 2);
+
+        // Destroying the source while waiting does not block.
+        source->setFileName(fifoName);
+        QTRY_COMPARE(source->status(), StreamSource::Active);
+        source.reset();
+
+        QVERIFY(timer.elapsed() < 5000);
+#else
+        QSKIP("Named pipes are only tested on Unix");
+#endif
+    }
+};
+
+QTEST_GUILESS_MAIN(StreamSourceTest)
+
+#include "StreamSourceTest.moc"
@@ -0,0 +1,122 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/SingleValueSource.h"
+#include "datasource/TimeSeriesSource.h"
+
+class TimeSeriesSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testAppend()
+    {
+        TimeSeriesSource source;
+        QVERIFY(source.hasXValues());
+        QSignalSpy insertedSpy(&source, &ChartDataSource::itemsInserted);
+
+        const std::vector<qreal> x{1.0, 2.0, 4.0, 8.0};
+        const std::vector<qreal> y{10.0, 20.0, 40.0, 80.0};
+        source.append(x, y);
+        QCOMPARE(insertedSpy.last(), (QVariantList{0, 4}));
+
+        // Items are kept sorted by X value.
+        source.append(3.0, 30.0);
+        QCOMPARE(insertedSpy.last(), (QVariantList{2, 1}));
+        QCOMPARE(source.lastChange().start, 2);
+
+        QCOMPARE(source.itemCount(), 5);
+        QCOMPARE(source.item(2), QVariant{30.0});
+        QCOMPARE(source.xValue(3), 4.0);
+        QCOMPARE(source.minimum(), QVariant{10.0});
+        QCOMPARE(source.maximum(), QVariant{80.0});
+
+        QList<qreal> values(3);
+        source.readXValues(3, 3, values.data());
+        QCOMPARE(values, (QList<qreal>{4.0, 8.0, 0.0}));
+
+        QCOMPARE(source.lowerBoundX(0.0), 0);
+        QCOMPARE(source.lowerBoundX(3.0), 2);
+        QCOMPARE(source.lowerBoundX(5.0), 4);
+        QCOMPARE(source.lowerBoundX(9.0), 5);
+    }
+
+    void testAppendMixed()
+    {
+        TimeSeriesSource source;
+        source.append(1.0, 10.0);
+        source.append(2.0, 20.0);
+        source.append(3.0, 30.0);
+        QSignalSpy insertedSpy(&source, &ChartDataSource::itemsInserted);
+
+        // Items that end up next to each other are a single insertion.
+        const std::vector<qreal> x{1.2, 1.5};
+        const std::vector<qreal> y{12.0, 15.0};
+        source.append(x, y);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(insertedSpy.last(), (QVariantList{1, 2}));
+        QCOMPARE(source.lastChange().start, 1);
+
+        // Items inserted in between existing items and at the end can not be
+        // described by a single insertion, so everything is changed.
+        const std::vector<qreal> mixedX{1.7, 10.0};
+        const std::vector<qreal> mixedY{17.0, 100.0};
+        source.append(mixedX, mixedY);
+        QCOMPARE(insertedSpy.count(), 1);
+        QVERIFY(source.lastChange().isReset());
+
+        QCOMPARE(source.itemCount(), 7);
+        QCOMPARE(source.xValue(3), 1.7);
+        QCOMPARE(source.item(6), QVariant{100.0});
+    }
+
+    void testExpire()
+    {
+        TimeSeriesSource source;
+        source.setMaximumAge(10.0);
+        QSignalSpy removedSpy(&source, &ChartDataSource::itemsRemoved);
+
+        for (int i = 0; i < 20; ++i) {
+            source.append(i * 2.0, i);
+        }
+
+        // Only items within 10 of the newest one remain.
+        QCOMPARE(source.itemCount(), 6);
+        QCOMPARE(source.xValue(0), 28.0);
+        QCOMPARE(removedSpy.last(), (QVariantList{0, 1}));
+
+        source.setMaximumItems(2);
+        QCOMPARE(source.itemCount(), 2);
+        QCOMPARE(source.item(0), QVariant{18.0});
+
+        source.clear();
+        QCOMPARE(source.itemCount(), 0);
+        QCOMPARE(source.lowerBoundX(1.0), 0);
+    }
+
+    void testWithoutXValues()
+    {
+        // Sources without X values use the index of items.
+        SingleValueSource source;
+        source.setValue(5.0);
+        QVERIFY(!source.hasXValues());
+
+        qreal x = -1.0;
+        source.readXValues(0, 1, &x);
+        QCOMPARE(x, 0.0);
+        QCOMPARE(source.lowerBoundX(-3.0), 0);
+        QCOMPARE(source.lowerBoundX(0.5), 1);
+        QCOMPARE(source.lowerBoundX(1e12), 1);
+    }
+};
+
+QTEST_GUILESS_MAIN(TimeSeriesSourceTest)
+
+#include "TimeSeriesSourceTest.moc"
@@ -0,0 +1,129 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/SeriesStore.h"
+#include "datasource/TopNProxySource.h"
+
+class TopNProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testSelection()
+    {
+        ArraySource values;
+        values.setValues(QList<double>{5.0, 1.0, 9.0, 3.0, 9.0, 2.0, 7.0});
+        ArraySource names;
+        names.setArray({QStringLiteral("a"), QStringLiteral("b"), QStringLiteral("c"), QStringLiteral("d"), QStringLiteral("e"), QStringLiteral("f"), QStringLiteral("g")});
+
+        TopNProxySource proxy;
+        proxy.setCount(3);
+        proxy.setNameSource(&names);
+        proxy.setSource(&values);
+
+        // Equal values keep the order of the source.
+        QCOMPARE(proxy.itemCount(), 4);
+        QCOMPARE(proxy.item(0), QVariant{9.0});
+        QCOMPARE(proxy.sourceIndex(0), 2);
+        QCOMPARE(proxy.item(1), QVariant{9.0});
+        QCOMPARE(proxy.sourceIndex(1), 4);
+        QCOMPARE(proxy.item(2), QVariant{7.0});
+        QCOMPARE(proxy.item(3), QVariant{11.0});
+        QCOMPARE(proxy.sourceIndex(3), -1);
+        QCOMPARE(proxy.minimum(), QVariant{7.0});
+        QCOMPARE(proxy.maximum(), QVariant{11.0});
+
+        QCOMPARE(proxy.names()->itemCount(), 4);
+        QCOMPARE(proxy.names()->item(0).toString(), QStringLiteral("c"));
+        QCOMPARE(proxy.names()->item(1).toString(), QStringLiteral("e"));
+        QCOMPARE(proxy.names()->item(2).toString(), QStringLiteral("g"));
+        QCOMPARE(proxy.names()->item(3).toString(), QStringLiteral("Other"));
+
+        // Without a color source, only the other item has a color.
+        QCOMPARE(proxy.colors()->item(0), QVariant{});
+        QCOMPARE(proxy.colors()->item(3).value<QColor>(), QColor(Qt::gray));
+
+        // Without more items than the count, there is no other item.
+        proxy.setCount(10);
+        QCOMPARE(proxy.itemCount(), 7);
+        QCOMPARE(proxy.item(6), QVariant{1.0});
+        QCOMPARE(proxy.names()->itemCount(), 7);
+    }
+
+    void testIncremental()
+    {
+        SeriesStore store;
+        for (auto value : {10.0, 20.0, 1.0, 2.0}) {
+            store.appendRow({value});
+        }
+
+        TopNProxySource proxy;
+        proxy.setCount(2);
+        proxy.setSource(store.series().first());
+        QCOMPARE(proxy.itemCount(), 3);
+        QCOMPARE(proxy.item(2), QVariant{3.0});
+
+        QSignalSpy changedSpy(&proxy, &ChartDataSource::itemsChanged);
+        QSignalSpy namesSpy(proxy.names(), &ChartDataSource::dataChanged);
+
+        // Changes to smaller items only change the other item.
+        store.setValue(0, 2, 5.0);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0), (QVariantList{2, 1}));
+        QCOMPARE(proxy.item(2), QVariant{7.0});
+        QCOMPARE(namesSpy.count(), 0);
+
+        store.appendRow({4.0});
+        QCOMPARE(changedSpy.count(), 2);
+        QCOMPARE(proxy.item(2), QVariant{11.0});
+        QCOMPARE(namesSpy.count(), 0);
+
+        // An item that becomes one of the largest changes the selection.
+        store.setValue(0, 3, 15.0);
+        QCOMPARE(namesSpy.count(), 1);
+        QCOMPARE(proxy.sourceIndex(0), 1);
+        QCOMPARE(proxy.sourceIndex(1), 3);
+        QCOMPARE(proxy.item(2), QVariant{19.0});
+
+        // As does a change to one of the largest items.
+        store.setValue(0, 1, 0.0);
+        QCOMPARE(namesSpy.count(), 2);
+        QCOMPARE(proxy.sourceIndex(0), 3);
+        QCOMPARE(proxy.sourceIndex(1), 0);
+        QCOMPARE(proxy.item(2), QVariant{9.0});
+    }
+
+    void testOtherAppears()
+    {
+        SeriesStore store;
+        store.appendRow({1.0});
+        store.appendRow({2.0});
+
+        TopNProxySource proxy;
+        proxy.setCount(2);
+        proxy.setSource(store.series().first());
+        QCOMPARE(proxy.itemCount(), 2);
+
+        QSignalSpy insertedSpy(&proxy, &ChartDataSource::itemsInserted);
+        QSignalSpy namesInsertedSpy(proxy.names(), &ChartDataSource::itemsInserted);
+
+        store.appendRow({0.5});
+        QCOMPARE(proxy.itemCount(), 3);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(namesInsertedSpy.count(), 1);
+        QCOMPARE(proxy.item(2), QVariant{0.5});
+        QCOMPARE(proxy.names()->item(2).toString(), QStringLiteral("Other"));
+    }
+};
+
+QTEST_GUILESS_MAIN(TopNProxySourceTest)
+
+#include "TopNProxySourceTest.moc"
@@ -105,6 +105,64 @@ void LegendModel::queueUpdate()
 
 void LegendModel::queueDataChange()
 {
+    m_changedFirst = 0;
+    m_changedLast = std::numeric_limits<int>::max();
+
+    if (!m_dataChangeQueued) {
+        m_dataChangeQueued = true;
+        QMetaObject::invokeMethod(this, &LegendModel::updateData, Qt::QueuedConnection);
+    }
+}
+
+void LegendModel::queueSourceDataChange(ChartDataSource *source)
+{
+    const auto change = source->lastChange();
+    if (change.isReset() || change.itemCountChanged || !m_chart) {
+        queueDataChange();
+        return;
+    }
+
+    // Determine which rows are affected by the changed items of this source.
+    const auto sources = m_chart->valueSources();
+    auto first = 0;
+    auto last = 0;
+    switch (m_chart->indexingMode()) {
+    case Chart::IndexSourceValues:
+        if (!sources.isEmpty() && sources.at(0) == source) {
+            first = change.start;
+            last = change.start + change.count;
+        }
+        break;
+    case Chart::IndexEachSource:
+        first = sources.indexOf(source);
+        last = first + 1;
+        break;
+    case Chart::IndexAllValues: {
+        auto offset = 0;
+        for (auto entry : sources) {
+            if (entry == source) {
+                break;
+            }
+            offset += entry->itemCount();
+        }
+        first = offset + change.start;
+        last = offset + change.start + change.count;
+        break;
+    }
+    }
+
+    if (first >= last) {
+        return;
+    }
+
+    if (m_changedFirst < m_changedLast) {
+        m_changedFirst = std::min(m_changedFirst, first);
+        m_changedLast = std::max(m_changedLast, last);
+    } else {
+        m_changedFirst = first;
+        m_changedLast = last;
+    }
+
     if (!m_dataChangeQueued) {
         m_dataChangeQueued = true;
         QMetaObject::invokeMethod(this, &LegendModel::updateData, Qt::QueuedConnection);
@@ -122,6 +180,13 @@ void LegendModel::update()
     beginResetModel();
     m_items.clear();
 
+    // Connections to lambdas cannot be made unique, so drop all existing
+    // connections before connecting again.
+    for (const auto &connection : std::as_const(m_connections)) {
+        disconnect(connection);
+    }
+    m_connections.clear();
+
     ChartDataSource *colorSource = m_chart->colorSource();
     ChartDataSource *nameSource = m_chart->nameSource();
     ChartDataSource *shortNameSource = m_chart->shortNameSource();
@@ -133,7 +198,9 @@ void LegendModel::update()
     int itemCount = countItems();
 
     std::transform(sources.cbegin(), sources.cend(), std::back_inserter(m_connections), [this](ChartDataSource *source) {
-        return connect(source, &ChartDataSource::dataChanged, this, &LegendModel::queueDataChange, Qt::UniqueConnection);
+        return connect(source, &ChartDataSource::dataChanged, this, [this, source]() {
+            queueSourceDataChange(source);
+        });
     });
 
     m_connections.push_back(connect(m_chart, &Chart::valueSourcesChanged, this, &LegendModel::queueUpdate, Qt::UniqueConnection));
@@ -177,6 +244,11 @@ void LegendModel::updateData()
 
     m_dataChangeQueued = false;
 
+    const auto first = std::clamp(m_changedFirst, 0, itemCount);
+    const auto last = std::clamp(m_changedLast, first, itemCount);
+    m_changedFirst = 0;
+    m_changedLast = 0;
+
     if (itemCount != int(m_items.size())) {
         // Number of items changed, so trigger a full update
         queueUpdate();
@@ -185,7 +257,7 @@ void LegendModel::updateData()
 
     QList<QList<int>> changedRows(itemCount);
 
-    std::for_each(m_items.begin(), m_items.end(), [&, i = 0](LegendItem &item) mutable {
+    std::for_each(m_items.begin() + first, m_items.begin() + last, [&, i = first](LegendItem &item) mutable {
         auto name = nameSource ? nameSource->item(i).toString() : QString{};
         if (item.name != name) {
             item.name = name;
@@ -213,7 +285,7 @@ void LegendModel::updateData()
         i++;
     });
 
-    for (auto i = 0; i < changedRows.size(); ++i) {
+    for (auto i = first; i < last; ++i) {
         auto changedRoles = changedRows.at(i);
         if (!changedRoles.isEmpty()) {
             Q_EMIT dataChanged(index(i, 0), index(i, 0), changedRoles);
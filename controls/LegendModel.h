@@ -57,6 +57,7 @@ public:
 private:
     void queueUpdate();
     void queueDataChange();
+    void queueSourceDataChange(ChartDataSource *source);
     void update();
     void updateData();
     int countItems();
@@ -66,6 +67,9 @@ private:
     int m_sourceIndex = UseSourceCount;
     bool m_updateQueued = false;
     bool m_dataChangeQueued = false;
+    // Range of rows that need to be checked for changes by updateData().
+    int m_changedFirst = 0;
+    int m_changedLast = 0;
     std::vector<QMetaObject::Connection> m_connections;
     std::vector<LegendItem> m_items;
 };
@@ -11,6 +11,7 @@
 
 #include "RangeGroup.h"
 #include "datasource/ChartDataSource.h"
+#include "datasource/SeriesStore.h"
 #include "scenegraph/BarChartNode.h"
 
 BarChart::BarChart(QQuickItem *parent)
@@ -155,64 +156,209 @@ void BarChart::onDataChanged()
     }
 
     m_barDataItems.clear();
+    m_totals.clear();
 
     updateComputedRange();
 
     const auto range = computedRange();
-    const auto sources = valueSources();
-    auto colors = colorSource();
-    auto indexMode = indexingMode();
-    auto colorIndex = 0;
 
     m_barDataItems.fill(QList<BarData>{}, range.distanceX);
+    if (stacked()) {
+        m_totals.fill(0.0, range.distanceX);
+    }
 
-    const auto highlightIndex = highlight();
+    updateBars(range, range.startX, range.startX + range.distanceX);
 
-    auto generator = [&, this, i = range.startX]() mutable -> QList<BarData> {
-        QList<BarData> colorInfos;
+    m_stackedMaximum = std::numeric_limits<qreal>::min();
+    for (auto total : std::as_const(m_totals)) {
+        m_stackedMaximum = std::max(m_stackedMaximum, total);
+    }
 
-        for (int j = 0; j < sources.count(); ++j) {
-            auto value = (sources.at(j)->item(i).toReal() - range.startY) / range.distanceY;
-            auto color = colors->item(colorIndex).value<QColor>();
+    update();
+}
 
-            if (highlightIndex >= 0 && highlightIndex != colorIndex) {
-                color = desaturate(color);
-            }
+void BarChart::onValueSourceDataChanged(ChartDataSource *source)
+{
+    const auto change = source->lastChange();
+    const auto previousRange = computedRange();
+    if (change.isReset() || m_barDataItems.isEmpty() || !colorSource() || previousRange.hasXValues
+        || m_barDataItems.size() != previousRange.distanceX || (stacked() && m_totals.size() != previousRange.distanceX)) {
+        XYChart::onValueSourceDataChanged(source);
+        return;
+    }
 
-            colorInfos << BarData{value, color};
+    const auto sources = valueSources();
+    const auto previousEnd = previousRange.startX + previousRange.distanceX;
+
+    // The X range only depends on the number of items, so it is cheap to
+    // determine. Only the Y range is kept until the changed bars are known.
+    const auto itemRange = xRange()->calculateRange(
+        sources,
+        [](ChartDataSource *) {
+            return 0;
+        },
+        [](ChartDataSource *source) {
+            return source->itemCount();
+        });
+
+    auto range = previousRange;
+    range.startX = itemRange.start;
+    range.endX = itemRange.end;
+    range.distanceX = itemRange.distance;
+    const auto rangeEnd = range.startX + range.distanceX;
+
+    // Items inserted or removed before the end of the existing bars move all
+    // bars after them, as does a different start of the range, so those need
+    // all bars to be recalculated. Items appended after them only add bars.
+    if (range.startX != previousRange.startX || rangeEnd < previousEnd || (change.itemCountChanged && change.start < previousEnd)) {
+        XYChart::onValueSourceDataChanged(source);
+        return;
+    }
 
-            if (indexMode != Chart::IndexSourceValues) {
-                colorIndex++;
-            }
+    if (rangeEnd > previousEnd) {
+        // Bars are stored in X order, which is reversed if zero is at the end.
+        const auto position = direction() == Direction::ZeroAtStart ? m_barDataItems.size() : 0;
+        m_barDataItems.insert(position, rangeEnd - previousEnd, QList<BarData>{});
+        if (stacked()) {
+            m_totals.resize(range.distanceX);
         }
+    }
 
-        if (stacked()) {
-            auto previous = 0.0;
-            for (auto &[colorVal, _] : colorInfos) {
-                colorVal += previous;
-                previous = colorVal;
-            }
+    const auto first = std::max(change.start, range.startX);
+    const auto last = std::min(change.start + change.count, previousEnd);
+
+    // When stacked, the largest total is the maximum of the Y range. If an
+    // item that had it changed, the maximum may have become smaller.
+    auto hadMaximum = false;
+    if (stacked()) {
+        for (int item = first; item < last; ++item) {
+            hadMaximum = hadMaximum || m_totals.at(item - range.startX) >= m_stackedMaximum;
         }
+    }
+
+    // Only the bars of the changed source need updating, unless bars are
+    // stacked, in which case all bars at the changed positions are affected.
+    // Appended bars are new, so they need all sources.
+    updateBars(range, first, last, source);
+    updateBars(range, previousEnd, rangeEnd);
 
-        if (indexMode == Chart::IndexSourceValues) {
-            colorIndex++;
-        } else if (indexMode == Chart::IndexEachSource) {
-            colorIndex = 0;
+    if (stacked()) {
+        auto maximum = std::numeric_limits<qreal>::min();
+        for (int item = first; item < last; ++item) {
+            maximum = std::max(maximum, m_totals.at(item - range.startX));
+        }
+        for (int item = previousEnd; item < rangeEnd; ++item) {
+            maximum = std::max(maximum, m_totals.at(item - range.startX));
         }
 
-        i++;
-        return colorInfos;
-    };
+        if (maximum >= m_stackedMaximum) {
+            m_stackedMaximum = maximum;
+        } else if (hadMaximum) {
+            m_stackedMaximum = std::numeric_limits<qreal>::min();
+            for (auto total : std::as_const(m_totals)) {
+                m_stackedMaximum = std::max(m_stackedMaximum, total);
+            }
+        }
+    }
 
-    if (direction() == Direction::ZeroAtStart) {
-        std::generate_n(m_barDataItems.begin(), range.distanceX, generator);
-    } else {
-        std::generate_n(m_barDataItems.rbegin(), range.distanceX, generator);
+    const auto valueRange = yRange()->calculateRange(
+        sources,
+        [](ChartDataSource *source) {
+            return std::min(0.0, source->minimum().toDouble());
+        },
+        [this](ChartDataSource *source) {
+            return stacked() ? m_stackedMaximum : source->maximum().toDouble();
+        });
+    range.startY = valueRange.start;
+    range.endY = valueRange.end;
+    range.distanceY = valueRange.distance;
+
+    // If the Y range changed, all bars need to be recalculated.
+    if (range.startY != previousRange.startY || range.endY != previousRange.endY) {
+        XYChart::onValueSourceDataChanged(source);
+        return;
     }
 
+    setComputedRange(range);
     update();
 }
 
+void BarChart::updateBars(const ComputedRange &range, int first, int last, ChartDataSource *changedSource)
+{
+    const auto count = last - first;
+    if (count <= 0) {
+        return;
+    }
+
+    const auto sources = valueSources();
+    const auto rangeEnd = range.startX + range.distanceX;
+    auto colors = colorSource();
+    const auto indexMode = indexingMode();
+    const auto highlightIndex = highlight();
+
+    // Series of a SeriesStore are read directly from the store, other sources
+    // are first copied into a buffer.
+    std::vector<std::vector<qreal>> buffers;
+    buffers.reserve(sources.count());
+    std::vector<const qreal *> sourceValues(sources.count(), nullptr);
+    for (int j = 0; j < sources.count(); ++j) {
+        auto source = sources.at(j);
+        if (changedSource && !stacked() && source != changedSource) {
+            continue;
+        }
+
+        auto series = qobject_cast<SeriesStoreSource *>(source);
+        if (series && first >= 0 && last <= series->itemCount()) {
+            sourceValues[j] = series->data() + first;
+            continue;
+        }
+
+        auto &values = buffers.emplace_back(count);
+        source->readValues(first, count, values.data());
+        sourceValues[j] = values.data();
+    }
+
+    for (int item = first; item < last; ++item) {
+        const auto row = direction() == Direction::ZeroAtStart ? item - range.startX : rangeEnd - 1 - item;
+        auto &bars = m_barDataItems[row];
+        bars.resize(sources.count());
+
+        auto total = 0.0;
+        auto previous = 0.0;
+        for (int j = 0; j < sources.count(); ++j) {
+            if (!sourceValues[j]) {
+                continue;
+            }
+
+            const auto value = sourceValues[j][item - first];
+            auto barValue = (value - range.startY) / range.distanceY;
+            if (stacked()) {
+                barValue += previous;
+                previous = barValue;
+                total += value;
+            }
+
+            auto colorIndex = j;
+            if (indexMode == Chart::IndexSourceValues) {
+                colorIndex = item - range.startX;
+            } else if (indexMode == Chart::IndexAllValues) {
+                colorIndex = (item - range.startX) * sources.count() + j;
+            }
+
+            auto color = colors->item(colorIndex).value<QColor>();
+            if (highlightIndex >= 0 && highlightIndex != colorIndex) {
+                color = desaturate(color);
+            }
+
+            bars[j] = BarData{barValue, color};
+        }
+
+        if (stacked()) {
+            m_totals[item - range.startX] = total;
+        }
+    }
+}
+
 QList<Bar> BarChart::calculateBars()
 {
     QList<Bar> result;
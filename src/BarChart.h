@@ -107,9 +107,20 @@ protected:
      * Reimplemented from Chart.
      */
     void onDataChanged() override;
+    /**
+     * Reimplemented from Chart.
+     */
+    void onValueSourceDataChanged(ChartDataSource *source) override;
 
 private:
     QList<Bar> calculateBars();
+    /**
+     * Update the bars of the items from \p first up to \p last for \p range.
+     *
+     * If \p changedSource is set and bars are not stacked, only the bars of
+     * that source are updated.
+     */
+    void updateBars(const ComputedRange &range, int first, int last, ChartDataSource *changedSource = nullptr);
 
     qreal m_spacing = 0.0;
     qreal m_barWidth = AutoWidth;
@@ -121,6 +132,10 @@ private:
         QColor color;
     };
     QList<QList<BarData>> m_barDataItems;
+    // The stacked total of each item within the X range, so the maximum can
+    // be updated when only some items change.
+    QList<qreal> m_totals;
+    qreal m_stackedMaximum = 0.0;
     QColor m_backgroundColor = Qt::transparent;
 };
 
@@ -7,6 +7,7 @@
 
 #include "Chart.h"
 #include "datasource/ChartDataSource.h"
+#include "datasource/SeriesStore.h"
 
 Chart::Chart(QQuickItem *parent)
     : QQuickItem(parent)
@@ -98,8 +99,7 @@ void Chart::insertValueSource(int index, ChartDataSource *source)
     }
 
     m_valueSources.insert(index, source);
-    connect(source, &QObject::destroyed, this, qOverload<QObject *>(&Chart::removeValueSource));
-    connect(source, &ChartDataSource::dataChanged, this, &Chart::dataChanged);
+    connectValueSource(source);
 
     Q_EMIT dataChanged();
     Q_EMIT valueSourcesChanged();
@@ -170,6 +170,21 @@ void Chart::resetHighlight()
     setHighlight(-1);
 }
 
+void Chart::onValueSourceDataChanged(ChartDataSource *source)
+{
+    Q_UNUSED(source);
+    Q_EMIT dataChanged();
+}
+
+void Chart::onValueSourcesDataChanged(const QList<ChartDataSource *> &sources)
+{
+    if (sources.size() == 1) {
+        onValueSourceDataChanged(sources.first());
+    } else if (!sources.isEmpty()) {
+        Q_EMIT dataChanged();
+    }
+}
+
 void Chart::componentComplete()
 {
     QQuickItem::componentComplete();
@@ -183,6 +198,37 @@ QColor Chart::desaturate(const QColor &input)
     return color.convertTo(QColor::Rgb);
 }
 
+void Chart::connectValueSource(ChartDataSource *source)
+{
+    connect(source, &QObject::destroyed, this, qOverload<QObject *>(&Chart::removeValueSource));
+
+    // Series of a store change together, so rather than handling each of them
+    // separately, handle all of them once the store has changed.
+    if (auto series = qobject_cast<SeriesStoreSource *>(source)) {
+        connect(series->store(), &SeriesStore::changed, this, &Chart::onSeriesStoreChanged, Qt::UniqueConnection);
+        return;
+    }
+
+    connect(source, &ChartDataSource::dataChanged, this, [this, source]() {
+        onValueSourceDataChanged(source);
+    });
+}
+
+void Chart::onSeriesStoreChanged()
+{
+    auto store = qobject_cast<SeriesStore *>(sender());
+
+    QList<ChartDataSource *> sources;
+    for (auto source : std::as_const(m_valueSources)) {
+        auto series = qobject_cast<SeriesStoreSource *>(source);
+        if (series && series->store() == store && !sources.contains(source)) {
+            sources.append(source);
+        }
+    }
+
+    onValueSourcesDataChanged(sources);
+}
+
 void Chart::appendSource(Chart::DataSourcesProperty *list, ChartDataSource *source)
 {
     auto chart = reinterpret_cast<Chart *>(list->data);
@@ -214,8 +260,7 @@ void Chart::replaceSource(DataSourcesProperty *list, qsizetype index, ChartDataS
     Q_ASSERT(index > 0 && index < chart->m_valueSources.size());
     chart->m_valueSources.at(index)->disconnect(chart);
     chart->m_valueSources.replace(index, source);
-    connect(source, &QObject::destroyed, chart, qOverload<QObject *>(&Chart::removeValueSource));
-    connect(source, &ChartDataSource::dataChanged, chart, &Chart::dataChanged);
+    chart->connectValueSource(source);
     Q_EMIT chart->dataChanged();
 }
 
@@ -109,6 +109,28 @@ protected:
      * rendering, then call update() to schedule rendering the item.
      */
     virtual void onDataChanged() = 0;
+    /**
+     * Called when the data of a single value source changes.
+     *
+     * The default implementation emits dataChanged(), which results in
+     * onDataChanged() being called. Subclasses can reimplement this and use
+     * ChartDataSource::lastChange() to only update the items that actually
+     * changed.
+     *
+     * \param source The value source that changed.
+     */
+    virtual void onValueSourceDataChanged(ChartDataSource *source);
+    /**
+     * Called when the data of several value sources changes at once.
+     *
+     * This happens when value sources are series of the same SeriesStore,
+     * which change together. The default implementation calls
+     * onValueSourceDataChanged() if only one source changed and emits
+     * dataChanged() otherwise, so the chart is only updated once.
+     *
+     * \param sources The value sources that changed.
+     */
+    virtual void onValueSourcesDataChanged(const QList<ChartDataSource *> &sources);
     void componentComplete() override;
 
     /**
@@ -120,6 +142,9 @@ protected:
     QColor desaturate(const QColor &input);
 
 private:
+    void connectValueSource(ChartDataSource *source);
+    void onSeriesStoreChanged();
+
     static void appendSource(DataSourcesProperty *list, ChartDataSource *source);
     static qsizetype sourceCount(DataSourcesProperty *list);
     static ChartDataSource *source(DataSourcesProperty *list, qsizetype index);
@@ -106,6 +106,11 @@ void LineChartAttached::setShortName(const QString &newShortName)
 LineChart::LineChart(QQuickItem *parent)
     : XYChart(parent)
 {
+    // Changing a range moves all points. This matters in particular for
+    // sources with X values, where the X range determines which items are
+    // visible.
+    connect(xRange(), &RangeGroup::rangeChanged, this, &LineChart::onDataChanged);
+    connect(yRange(), &RangeGroup::rangeChanged, this, &LineChart::onDataChanged);
 }
 
 bool LineChart::interpolate() const
@@ -130,6 +135,7 @@ void LineChart::setInterpolate(bool newInterpolate)
     }
 
     m_interpolate = newInterpolate;
+    m_updateAll = true;
     polish();
     Q_EMIT interpolateChanged();
 }
@@ -188,41 +194,97 @@ void LineChart::setPointDelegate(QQmlComponent *newPointDelegate)
         qDeleteAll(entry);
     }
     m_pointDelegates.clear();
+    m_updateAll = true;
     polish();
     Q_EMIT pointDelegateChanged();
 }
 
 void LineChart::updatePolish()
 {
+    const auto previousRange = computedRange();
     if (m_rangeInvalid) {
-        updateComputedRange();
+        if (m_updateAll || !updateRangeForDirtyItems()) {
+            updateComputedRange();
+
+            const auto range = computedRange();
+            m_totals.clear();
+            if (stacked() && !range.hasXValues) {
+                m_totals.resize(std::max(range.distanceX, 0));
+                m_stackedMaximum = updateTotals(range, range.startX, range.startX + range.distanceX);
+            }
+        }
         m_rangeInvalid = false;
     }
 
+    const auto range = computedRange();
+    // Any change to the range moves all points, so everything needs updating.
+    const bool updateAll = m_updateAll || !(range == previousRange);
+
     QList<QVector2D> previousValues;
+    QList<qreal> sourceValues;
 
-    const auto range = computedRange();
+    // Items that changed in sources below the current one. When stacking,
+    // these also need to be updated for every source that follows.
+    auto stackedFirst = std::numeric_limits<int>::max();
+    auto stackedLast = std::numeric_limits<int>::min();
+
+    const auto rangeEnd = range.startX + range.distanceX;
     const auto sources = valueSources();
     for (int i = 0; i < sources.size(); ++i) {
         auto valueSource = sources.at(i);
 
+        if (range.hasXValues) {
+            // The points depend on the X range rather than item indices, so
+            // all visible points are updated.
+            const auto points = calculateXValuePoints(valueSource, range);
+            qDeleteAll(m_pointDelegates.take(valueSource));
+            m_points[valueSource] = points;
+            m_values[valueSource] = m_interpolate ? interpolatePoints(points, height()) : points;
+            continue;
+        }
+
+        auto values = m_points.value(valueSource);
+
+        // Determine the range of items that need to be updated.
+        auto first = range.startX;
+        auto last = rangeEnd;
+        const bool partial = !updateAll && values.size() == range.distanceX;
+        if (partial) {
+            const auto dirty = m_dirtyItems.value(valueSource, {std::numeric_limits<int>::max(), std::numeric_limits<int>::min()});
+            first = std::max(std::min(dirty.first, stacked() ? stackedFirst : dirty.first), range.startX);
+            last = std::min(std::max(dirty.second, stacked() ? stackedLast : dirty.second), rangeEnd);
+        } else {
+            values.resize(range.distanceX);
+        }
+
+        if (partial && first >= last) {
+            previousValues = values;
+            continue;
+        }
+
+        stackedFirst = std::min(stackedFirst, first);
+        stackedLast = std::max(stackedLast, last);
+
+        const auto count = last - first;
+        sourceValues.resize(count);
+        valueSource->readValues(first, count, sourceValues.data());
+
+        // Points are stored in X order, which is reversed if zero is at the end.
+        const auto pointFirst = direction() == Direction::ZeroAtStart ? first - range.startX : rangeEnd - last;
+        const auto pointLast = pointFirst + count;
+
         float stepSize = width() / (range.distanceX - 1);
-        QList<QVector2D> values(range.distanceX);
-        auto generator = [&, i = range.startX]() mutable -> QVector2D {
+        for (int item = first; item < last; ++item) {
             float value = 0;
             if (range.distanceY != 0) {
-                value = (valueSource->item(i).toFloat() - range.startY) / range.distanceY;
+                value = (sourceValues.at(item - first) - range.startY) / range.distanceY;
             }
 
-            auto result = QVector2D{direction() == Direction::ZeroAtStart ? i * stepSize : float(boundingRect().right()) - i * stepSize, value};
-            i++;
-            return result;
-        };
-
-        if (direction() == Direction::ZeroAtStart) {
-            std::generate_n(values.begin(), range.distanceX, generator);
-        } else {
-            std::generate_n(values.rbegin(), range.distanceX, generator);
+            if (direction() == Direction::ZeroAtStart) {
+                values[item - range.startX] = QVector2D{item * stepSize, value};
+            } else {
+                values[rangeEnd - 1 - item] = QVector2D{float(boundingRect().right()) - item * stepSize, value};
+            }
         }
 
         if (stacked() && !previousValues.isEmpty()) {
@@ -230,9 +292,9 @@ void LineChart::updatePolish()
                 qWarning() << "Value source" << valueSource->objectName()
                            << "has a different number of elements from the previous source. Ignoring stacking for this source.";
             } else {
-                std::for_each(values.begin(), values.end(), [previousValues, i = 0](QVector2D &point) mutable {
-                    point.setY(point.y() + previousValues.at(i++).y());
-                });
+                for (int point = pointFirst; point < pointLast; ++point) {
+                    values[point].setY(values.at(point).y() + previousValues.at(point).y());
+                }
             }
         }
         previousValues = values;
@@ -243,13 +305,14 @@ void LineChart::updatePolish()
                 qDeleteAll(delegates);
                 createPointDelegates(values, i);
             } else {
-                for (int item = 0; item < values.size(); ++item) {
-                    auto delegate = delegates.at(item);
-                    updatePointDelegate(delegate, values.at(item), valueSource->item(item), i);
+                for (int point = pointFirst; point < pointLast; ++point) {
+                    auto delegate = delegates.at(point);
+                    updatePointDelegate(delegate, values.at(point), valueSource->item(point), i);
                 }
             }
         }
 
+        m_points[valueSource] = values;
         if (m_interpolate) {
             m_values[valueSource] = interpolatePoints(values, height());
         } else {
@@ -265,6 +328,17 @@ void LineChart::updatePolish()
         }
     }
 
+    const auto valueKeys = m_points.keys();
+    for (auto key : valueKeys) {
+        if (!sources.contains(key)) {
+            m_points.remove(key);
+            m_values.remove(key);
+        }
+    }
+
+    m_updateAll = false;
+    m_dirtyItems.clear();
+
     update();
 }
 
@@ -319,13 +393,51 @@ QSGNode *LineChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
 void LineChart::onDataChanged()
 {
     m_rangeInvalid = true;
+    m_updateAll = true;
     polish();
 }
 
+void LineChart::onValueSourceDataChanged(ChartDataSource *source)
+{
+    const auto change = source->lastChange();
+
+    auto first = 0;
+    auto last = std::numeric_limits<int>::max();
+    if (!change.isReset()) {
+        first = change.start;
+        // Items past the new end may have been removed, so those need to be
+        // updated as well if the number of items changed.
+        if (!change.itemCountChanged) {
+            last = change.start + change.count;
+        }
+    }
+
+    auto itr = m_dirtyItems.find(source);
+    if (itr != m_dirtyItems.end()) {
+        itr->first = std::min(itr->first, first);
+        itr->second = std::max(itr->second, last);
+    } else {
+        m_dirtyItems.insert(source, {first, last});
+    }
+
+    m_rangeInvalid = true;
+    polish();
+}
+
+void LineChart::onValueSourcesDataChanged(const QList<ChartDataSource *> &sources)
+{
+    // Changes are only applied when polishing, so each line can be updated
+    // separately without updating the chart more than once.
+    for (auto source : sources) {
+        onValueSourceDataChanged(source);
+    }
+}
+
 void LineChart::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
     XYChart::geometryChange(newGeometry, oldGeometry);
     if (newGeometry != oldGeometry) {
+        m_updateAll = true;
         polish();
     }
 }
@@ -347,6 +459,174 @@ void LineChart::updateLineNode(LineChartNode *node, ChartDataSource *valueSource
     node->updatePoints();
 }
 
+bool LineChart::updateRangeForDirtyItems()
+{
+    const auto previousRange = computedRange();
+    if (previousRange.hasXValues || (stacked() && m_totals.size() != previousRange.distanceX)) {
+        return false;
+    }
+
+    const auto sources = valueSources();
+
+    // The X range only depends on the number of items, so it is cheap to
+    // determine.
+    const auto itemRange = xRange()->calculateRange(
+        sources,
+        [](ChartDataSource *) {
+            return 0;
+        },
+        [](ChartDataSource *source) {
+            return source->itemCount();
+        });
+
+    auto range = previousRange;
+    range.startX = itemRange.start;
+    range.endX = itemRange.end;
+    range.distanceX = itemRange.distance;
+
+    // The totals are stored relative to the start of the range.
+    if (range.startX != previousRange.startX) {
+        return false;
+    }
+
+    if (stacked()) {
+        const auto previousEnd = previousRange.startX + previousRange.distanceX;
+        const auto rangeEnd = range.startX + range.distanceX;
+
+        // Only the totals of items that were added, removed or changed in
+        // any source need to be calculated again.
+        auto first = std::numeric_limits<int>::max();
+        auto last = std::numeric_limits<int>::min();
+        if (rangeEnd != previousEnd) {
+            first = std::min(previousEnd, rangeEnd);
+            last = rangeEnd;
+        }
+        for (const auto &dirty : std::as_const(m_dirtyItems)) {
+            first = std::min(first, std::max(dirty.first, range.startX));
+            last = std::max(last, std::min(dirty.second, rangeEnd));
+        }
+
+        // If an item that had the largest total changed or was removed, the
+        // maximum may have become smaller.
+        auto hadMaximum = false;
+        for (int item = first; item < previousEnd; ++item) {
+            hadMaximum = hadMaximum || m_totals.at(item - range.startX) >= m_stackedMaximum;
+        }
+
+        m_totals.resize(std::max(range.distanceX, 0));
+        const auto maximum = updateTotals(range, first, last);
+        if (maximum >= m_stackedMaximum) {
+            m_stackedMaximum = maximum;
+        } else if (hadMaximum) {
+            m_stackedMaximum = std::numeric_limits<qreal>::min();
+            for (auto total : std::as_const(m_totals)) {
+                m_stackedMaximum = std::max(m_stackedMaximum, total);
+            }
+        }
+    }
+
+    const auto valueRange = yRange()->calculateRange(
+        sources,
+        [](ChartDataSource *source) {
+            return std::min(0.0, source->minimum().toDouble());
+        },
+        [this](ChartDataSource *source) {
+            return stacked() ? m_stackedMaximum : source->maximum().toDouble();
+        });
+    range.startY = valueRange.start;
+    range.endY = valueRange.end;
+    range.distanceY = valueRange.distance;
+
+    setComputedRange(range);
+    return true;
+}
+
+qreal LineChart::updateTotals(const ComputedRange &range, int first, int last)
+{
+    auto maximum = std::numeric_limits<qreal>::min();
+    const auto count = last - first;
+    if (count <= 0) {
+        return maximum;
+    }
+
+    const auto totals = m_totals.begin() + (first - range.startX);
+    std::fill_n(totals, count, 0.0);
+
+    std::vector<qreal> values(count);
+    const auto sources = valueSources();
+    for (auto source : sources) {
+        source->readValues(first, count, values.data());
+        std::transform(totals, totals + count, values.cbegin(), totals, std::plus<qreal>{});
+    }
+
+    return std::max(maximum, *std::max_element(totals, totals + count));
+}
+
+QList<QVector2D> LineChart::calculateXValuePoints(ChartDataSource *source, const ComputedRange &range) const
+{
+    if (range.distanceXValue <= 0.0) {
+        return {};
+    }
+
+    // Only the items within the X range are visible. The items on either side
+    // of it determine where the line crosses the edges.
+    const auto first = std::max(source->lowerBoundX(range.startXValue) - 1, 0);
+    const auto last = std::min(source->lowerBoundX(range.endXValue) + 1, source->itemCount());
+    const auto count = last - first;
+    if (count <= 0) {
+        return {};
+    }
+
+    std::vector<qreal> xValues(count);
+    std::vector<qreal> values(count);
+    source->readXValues(first, count, xValues.data());
+    source->readValues(first, count, values.data());
+
+    const auto chartWidth = width();
+    auto toPoint = [&range, chartWidth](qreal x, qreal y) {
+        float value = 0;
+        if (range.distanceY != 0) {
+            value = (y - range.startY) / range.distanceY;
+        }
+        return QVector2D{float((x - range.startXValue) / range.distanceXValue * chartWidth), value};
+    };
+    auto interpolate = [&](int index, qreal x) {
+        const auto factor = (x - xValues[index]) / (xValues[index + 1] - xValues[index]);
+        return values[index] + factor * (values[index + 1] - values[index]);
+    };
+
+    QList<QVector2D> points;
+    points.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const auto x = xValues[i];
+        if (x < range.startXValue) {
+            if (i + 1 < count && xValues[i + 1] > range.startXValue) {
+                points.append(toPoint(range.startXValue, interpolate(i, range.startXValue)));
+            }
+            continue;
+        }
+
+        if (x > range.endXValue) {
+            if (i > 0 && xValues[i - 1] < range.endXValue) {
+                points.append(toPoint(range.endXValue, interpolate(i - 1, range.endXValue)));
+            }
+            break;
+        }
+
+        points.append(toPoint(x, values[i]));
+    }
+
+    // Points are stored in X order, which is reversed if zero is at the end.
+    if (direction() == Direction::ZeroAtEnd) {
+        std::reverse(points.begin(), points.end());
+        for (auto &point : points) {
+            point.setX(float(chartWidth) - point.x());
+        }
+    }
+
+    return points;
+}
+
 void LineChart::createPointDelegates(const QList<QVector2D> &values, int sourceIndex)
 {
     auto valueSource = valueSources().at(sourceIndex);
@@ -76,6 +76,14 @@ private:
  * \snippet snippets/linechart.qml example
  *
  * \image html linechart.png "The resulting line chart."
+ *
+ * When a value source reports which of its items changed, only the range and
+ * the points of those items are calculated again. If that changes the range,
+ * all points move, so the whole line is calculated again. This is the case
+ * for every new item when items are appended to a source and the X range is
+ * automatic. Interpolating the line and updating the scene graph always
+ * process the whole line, so the cost of updating a line chart grows linearly
+ * with the number of items within the X range.
  */
 class QUICKCHARTS_EXPORT LineChart : public XYChart
 {
@@ -131,6 +139,9 @@ public:
      *
      * \note The component assigned to this property is expected to create a
      *       QQuickItem, since the created object needs to be positioned.
+     *
+     * \note Points of value sources that provide X values do not get a
+     *       delegate.
      */
     Q_PROPERTY(QQmlComponent *pointDelegate READ pointDelegate WRITE setPointDelegate NOTIFY pointDelegateChanged)
     QQmlComponent *pointDelegate() const;
@@ -146,9 +157,20 @@ protected:
     void updatePolish() override;
     QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data) override;
     void onDataChanged() override;
+    void onValueSourceDataChanged(ChartDataSource *source) override;
+    void onValueSourcesDataChanged(const QList<ChartDataSource *> &sources) override;
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    /**
+     * Calculate the points of \p source for a range that has X values.
+     *
+     * Only the items within the X range of \p range are included, with
+     * interpolated points where the line crosses the edges of the range.
+     */
+    QList<QVector2D> calculateXValuePoints(ChartDataSource *source, const ComputedRange &range) const;
 
 private:
+    bool updateRangeForDirtyItems();
+    qreal updateTotals(const ComputedRange &range, int first, int last);
     void updateLineNode(LineChartNode *node, ChartDataSource *valueSource, const QColor &lineColor, const QColor &fillColor, qreal lineWidth);
     void createPointDelegates(const QList<QVector2D> &values, int sourceIndex);
     void updatePointDelegate(QQuickItem *delegate, const QVector2D &position, const QVariant &value, int sourceIndex);
@@ -157,8 +179,17 @@ private:
     qreal m_lineWidth = 1.0;
     qreal m_fillOpacity = 0.0;
     bool m_rangeInvalid = true;
+    bool m_updateAll = true;
     ChartDataSource *m_fillColorSource = nullptr;
+    // Points before interpolation, used when only part of a source changed.
+    QHash<ChartDataSource *, QList<QVector2D>> m_points;
     QHash<ChartDataSource *, QList<QVector2D>> m_values;
+    // Range of items that changed per source since the last polish.
+    QHash<ChartDataSource *, std::pair<int, int>> m_dirtyItems;
+    // The stacked total of each item within the X range, so the range can be
+    // updated when only some items changed.
+    QList<qreal> m_totals;
+    qreal m_stackedMaximum = 0.0;
     QQmlComponent *m_pointDelegate = nullptr;
     QHash<ChartDataSource *, QList<QQuickItem *>> m_pointDelegates;
 };
@@ -196,12 +196,16 @@ void PieChart::onDataChanged()
         return;
     }
 
+    QList<QList<qreal>> sourceValues;
+    sourceValues.reserve(sources.size());
+    for (auto source : sources) {
+        QList<qreal> values(source->itemCount());
+        source->readValues(0, values.size(), values.data());
+        sourceValues.append(values);
+    }
+
     auto maximum = [](ChartDataSource *source) {
-        qreal result = 0.0;
-        for (int i = 0; i < source->itemCount(); ++i) {
-            result += source->item(i).toDouble();
-        }
-        return std::max(result, source->maximum().toDouble());
+        return std::max(source->statistics().sum, source->maximum().toDouble());
     };
 
     auto indexMode = indexingMode();
@@ -212,15 +216,14 @@ void PieChart::onDataChanged()
     };
     auto range = m_range->calculateRange(valueSources(), calculateZeroRange, maximum);
 
-    for (auto source : sources) {
+    for (const auto &values : std::as_const(sourceValues)) {
         qreal threshold = range.start;
         qreal total = 0.0;
 
         QList<qreal> sections;
         QList<QColor> sectionColors;
 
-        for (int i = 0; i < source->itemCount(); ++i) {
-            auto value = source->item(i).toReal();
+        for (auto value : values) {
             auto limited = value - threshold;
             if (limited > 0.0) {
                 if (total + limited >= range.end) {
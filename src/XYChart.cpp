@@ -7,12 +7,16 @@
 
 #include "XYChart.h"
 
+#include <QHash>
+
 #include "RangeGroup.h"
 #include "datasource/ChartDataSource.h"
+#include "datasource/SeriesStore.h"
 
 bool operator==(const ComputedRange &first, const ComputedRange &second)
 {
-    return first.startX == second.startX && first.endX == second.endX && qFuzzyCompare(first.startY, second.startY) && qFuzzyCompare(first.endY, second.endY);
+    return first.startX == second.startX && first.endX == second.endX && qFuzzyCompare(first.startY, second.startY) && qFuzzyCompare(first.endY, second.endY)
+        && first.hasXValues == second.hasXValues && first.startXValue == second.startXValue && first.endXValue == second.endXValue;
 }
 
 XYChart::XYChart(QQuickItem *parent)
@@ -79,6 +83,14 @@ void XYChart::updateComputedRange()
 
     ComputedRange result;
 
+    const auto sources = valueSources();
+    if (std::all_of(sources.cbegin(), sources.cend(), [](ChartDataSource *source) {
+            return source->hasXValues();
+        })) {
+        updateXValueRange(result);
+        return;
+    }
+
     auto xRange = m_xRange->calculateRange(
         valueSources(),
         [](ChartDataSource *) {
@@ -91,19 +103,38 @@ void XYChart::updateComputedRange()
     result.endX = xRange.end;
     result.distanceX = xRange.distance;
 
-    auto maximumY = [this, xRange](ChartDataSource *source) {
+    // When stacked, the maximum is the largest sum of all sources at a single
+    // X position. That is the same for every source, so calculate it once.
+    qreal stackedMaximum = std::numeric_limits<qreal>::min();
+    if (m_stacked) {
+        const int start = xRange.start;
+        const int count = std::max(int(xRange.end) - start, 0);
+
+        QList<qreal> totals(count, 0.0);
+        QList<qreal> values(count);
+        for (auto source : sources) {
+            // Series of a SeriesStore can be summed directly from the store.
+            auto series = qobject_cast<SeriesStoreSource *>(source);
+            if (series && start >= 0 && start + count <= series->itemCount()) {
+                const auto column = series->data() + start;
+                std::transform(totals.cbegin(), totals.cend(), column, totals.begin(), std::plus<qreal>{});
+                continue;
+            }
+
+            source->readValues(start, count, values.data());
+            std::transform(totals.cbegin(), totals.cend(), values.cbegin(), totals.begin(), std::plus<qreal>{});
+        }
+
+        for (auto total : std::as_const(totals)) {
+            stackedMaximum = std::max(stackedMaximum, total);
+        }
+    }
+
+    auto maximumY = [this, stackedMaximum](ChartDataSource *source) {
         if (!m_stacked) {
             return source->maximum().toDouble();
         } else {
-            qreal max = std::numeric_limits<qreal>::min();
-            for (int i = xRange.start; i < xRange.end; ++i) {
-                qreal yDistance = 0.0;
-                for (auto source : valueSources()) {
-                    yDistance += source->item(i).toDouble();
-                }
-                max = std::max(max, yDistance);
-            }
-            return max;
+            return stackedMaximum;
         }
     };
 
@@ -120,6 +151,89 @@ void XYChart::updateComputedRange()
     setComputedRange(result);
 }
 
+void XYChart::updateXValueRange(ComputedRange &result)
+{
+    const auto sources = valueSources();
+
+    auto firstX = [](ChartDataSource *source) {
+        qreal value = std::numeric_limits<qreal>::max();
+        if (source->itemCount() > 0) {
+            source->readXValues(0, 1, &value);
+        }
+        return value;
+    };
+    auto lastX = [](ChartDataSource *source) {
+        qreal value = std::numeric_limits<qreal>::lowest();
+        if (source->itemCount() > 0) {
+            source->readXValues(source->itemCount() - 1, 1, &value);
+        }
+        return value;
+    };
+
+    const auto hasItems = std::any_of(sources.cbegin(), sources.cend(), [](ChartDataSource *source) {
+        return source->itemCount() > 0;
+    });
+
+    result.hasXValues = true;
+    if (hasItems || !m_xRange->automatic()) {
+        const auto xRange = m_xRange->calculateRange(sources, firstX, lastX);
+        result.startXValue = xRange.start;
+        result.endXValue = xRange.end;
+        result.distanceXValue = xRange.distance;
+    }
+
+    // Every source has its own items within the X range, so the item range
+    // covers all items.
+    int itemCount = 0;
+    for (auto source : sources) {
+        itemCount = std::max(itemCount, source->itemCount());
+    }
+    result.endX = itemCount;
+    result.distanceX = itemCount;
+
+    // Only the items within the X range are visible, so only use those to
+    // determine the Y range. These are found using a binary search, so
+    // sources with many items outside of the range are cheap.
+    QHash<ChartDataSource *, std::pair<qreal, qreal>> visibleRanges;
+    if (m_yRange->automatic()) {
+        std::vector<qreal> values;
+        for (auto source : sources) {
+            const auto first = source->lowerBoundX(result.startXValue);
+            auto last = source->lowerBoundX(result.endXValue);
+            if (last < source->itemCount()) {
+                qreal x = 0.0;
+                source->readXValues(last, 1, &x);
+                if (x <= result.endXValue) {
+                    last++;
+                }
+            }
+
+            if (first >= last) {
+                continue;
+            }
+
+            values.resize(last - first);
+            source->readValues(first, last - first, values.data());
+            const auto [minimum, maximum] = std::minmax_element(values.cbegin(), values.cend());
+            visibleRanges.insert(source, {*minimum, *maximum});
+        }
+    }
+
+    auto yRange = m_yRange->calculateRange(
+        sources,
+        [&visibleRanges](ChartDataSource *source) {
+            return std::min(0.0, visibleRanges.value(source, {0.0, 0.0}).first);
+        },
+        [&visibleRanges](ChartDataSource *source) {
+            return visibleRanges.value(source, {0.0, 0.0}).second;
+        });
+    result.startY = yRange.start;
+    result.endY = yRange.end;
+    result.distanceY = yRange.distance;
+
+    setComputedRange(result);
+}
+
 void XYChart::setComputedRange(ComputedRange range)
 {
     if (range == m_computedRange) {
@@ -134,6 +248,9 @@ QDebug operator<<(QDebug debug, const ComputedRange &range)
 {
     debug << "Range: startX" << range.startX << "endX" << range.endX << "distance" << range.distanceX << "startY" << range.startY << "endY" << range.endY
           << "distance" << range.distanceY;
+    if (range.hasXValues) {
+        debug << "startXValue" << range.startXValue << "endXValue" << range.endXValue << "distance" << range.distanceXValue;
+    }
     return debug;
 }
 
@@ -22,6 +22,12 @@ struct ComputedRange {
     float startY = 0.0;
     float endY = 0.0;
     float distanceY = 0.0;
+    // When all value sources have X values, the range of X values, in the
+    // units of those values.
+    bool hasXValues = false;
+    qreal startXValue = 0.0;
+    qreal endXValue = 0.0;
+    qreal distanceXValue = 0.0;
 };
 
 bool operator==(const ComputedRange &first, const ComputedRange &second);
@@ -63,6 +69,10 @@ public:
 
     /**
      * The range of values on the X axis.
+     *
+     * If all value sources provide X values, like TimeSeriesSource does, the
+     * range is in the units of those values and items are placed according to
+     * their X value. Otherwise, the range is in items.
      */
     Q_PROPERTY(RangeGroup *xRange READ xRange CONSTANT)
     virtual RangeGroup *xRange() const;
@@ -84,6 +94,8 @@ public:
      * When true, Y values will be added on top of each other. The precise
      * meaning of this property depends on the specific chart. The default is
      * false.
+     *
+     * \note Value sources that provide X values are not stacked.
      */
     Q_PROPERTY(bool stacked READ stacked WRITE setStacked NOTIFY stackedChanged)
     bool stacked() const;
@@ -117,6 +129,8 @@ protected:
     void setComputedRange(ComputedRange range);
 
 private:
+    void updateXValueRange(ComputedRange &result);
+
     RangeGroup *m_xRange = nullptr;
     RangeGroup *m_yRange = nullptr;
     Direction m_direction = Direction::ZeroAtStart;
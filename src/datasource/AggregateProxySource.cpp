@@ -0,0 +1,227 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "AggregateProxySource.h"
+
+#include <numeric>
+#include <vector>
+
+AggregateProxySource::AggregateProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &AggregateProxySource::sourceChanged, this, &AggregateProxySource::update);
+    connect(this, &AggregateProxySource::bucketSizeChanged, this, &AggregateProxySource::update);
+    connect(this, &AggregateProxySource::aggregationChanged, this, &AggregateProxySource::update);
+}
+
+ChartDataSource *AggregateProxySource::source() const
+{
+    return m_source;
+}
+
+void AggregateProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &AggregateProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int AggregateProxySource::bucketSize() const
+{
+    return m_bucketSize;
+}
+
+void AggregateProxySource::setBucketSize(int newBucketSize)
+{
+    newBucketSize = std::max(newBucketSize, 1);
+    if (newBucketSize == m_bucketSize) {
+        return;
+    }
+
+    m_bucketSize = newBucketSize;
+    Q_EMIT bucketSizeChanged();
+}
+
+AggregateProxySource::Aggregation AggregateProxySource::aggregation() const
+{
+    return m_aggregation;
+}
+
+void AggregateProxySource::setAggregation(Aggregation newAggregation)
+{
+    if (newAggregation == m_aggregation) {
+        return;
+    }
+
+    m_aggregation = newAggregation;
+    Q_EMIT aggregationChanged();
+}
+
+int AggregateProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant AggregateProxySource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant AggregateProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant AggregateProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void AggregateProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_values.size()));
+    if (first < last) {
+        std::copy(m_values.cbegin() + first, m_values.cbegin() + last, output + (first - start));
+    }
+}
+
+void AggregateProxySource::update()
+{
+    m_sourceCount = m_source ? m_source->itemCount() : 0;
+    m_values.resize((m_sourceCount + m_bucketSize - 1) / m_bucketSize);
+    aggregate(0, m_values.size());
+
+    Q_EMIT dataChanged();
+}
+
+void AggregateProxySource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+
+    if (change.isReset() || m_sourceCount == 0) {
+        update();
+        return;
+    }
+
+    auto firstItem = 0;
+    auto lastItem = 0;
+    if (!change.itemCountChanged && count == m_sourceCount) {
+        // Only the buckets containing the changed items are affected.
+        firstItem = change.start;
+        lastItem = std::min(change.start + change.count, count);
+    } else if (change.start == m_sourceCount && count > m_sourceCount) {
+        // Appending items only affects the last bucket, if it was partially
+        // filled, and any new buckets.
+        firstItem = m_sourceCount;
+        lastItem = count;
+    } else {
+        update();
+        return;
+    }
+
+    if (firstItem >= lastItem) {
+        return;
+    }
+
+    const auto previousCount = int(m_values.size());
+    m_sourceCount = count;
+    m_values.resize((m_sourceCount + m_bucketSize - 1) / m_bucketSize);
+
+    const auto firstBucket = firstItem / m_bucketSize;
+    const auto lastBucket = (lastItem - 1) / m_bucketSize + 1;
+    aggregate(firstBucket, lastBucket);
+
+    const auto changedEnd = std::min(lastBucket, previousCount);
+    if (changedEnd > firstBucket) {
+        Q_EMIT itemsChanged(firstBucket, changedEnd - firstBucket);
+    }
+    if (m_values.size() > previousCount) {
+        Q_EMIT itemsInserted(previousCount, m_values.size() - previousCount);
+    }
+    Q_EMIT dataChanged();
+}
+
+void AggregateProxySource::aggregate(int firstBucket, int lastBucket)
+{
+    if (firstBucket >= lastBucket) {
+        return;
+    }
+
+    const auto readStart = firstBucket * m_bucketSize;
+    const auto readEnd = std::min(lastBucket * m_bucketSize, m_sourceCount);
+
+    std::vector<qreal> values;
+    if (m_aggregation != Count) {
+        values.resize(readEnd - readStart);
+        m_source->readValues(readStart, int(values.size()), values.data());
+    }
+
+    for (int bucket = firstBucket; bucket < lastBucket; ++bucket) {
+        const auto bucketStart = bucket * m_bucketSize;
+        const auto bucketEnd = std::min(bucketStart + m_bucketSize, m_sourceCount);
+
+        if (m_aggregation == Count) {
+            m_values[bucket] = bucketEnd - bucketStart;
+            continue;
+        }
+
+        const auto begin = values.cbegin() + (bucketStart - readStart);
+        const auto end = values.cbegin() + (bucketEnd - readStart);
+        switch (m_aggregation) {
+        case Mean:
+            m_values[bucket] = std::accumulate(begin, end, 0.0) / (bucketEnd - bucketStart);
+            break;
+        case Minimum:
+            m_values[bucket] = *std::min_element(begin, end);
+            break;
+        case Maximum:
+            m_values[bucket] = *std::max_element(begin, end);
+            break;
+        case Sum:
+            m_values[bucket] = std::accumulate(begin, end, 0.0);
+            break;
+        case Count:
+            break;
+        }
+    }
+}
+
+#include "moc_AggregateProxySource.cpp"
@@ -0,0 +1,96 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef AGGREGATEPROXYSOURCE_H
+#define AGGREGATEPROXYSOURCE_H
+
+#include <QList>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that combines groups of items of a different data source.
+ *
+ * This source divides the items of another source into consecutive buckets of
+ * \ref bucketSize items and provides one item for each bucket, calculated using
+ * \ref aggregation. For example, a source with one item per second can be
+ * shown as one bar per minute by using a bucket size of 60. If the number of
+ * items is not a multiple of the bucket size, the last bucket contains fewer
+ * items.
+ *
+ * When items are appended to the source, only the buckets containing new
+ * items are recalculated. Similarly, when items of the source change, only the
+ * buckets containing them are recalculated.
+ */
+class QUICKCHARTS_EXPORT AggregateProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * How the items of a bucket are combined.
+     */
+    enum Aggregation {
+        Mean, ///< The average of the items.
+        Minimum, ///< The smallest item.
+        Maximum, ///< The largest item.
+        Sum, ///< The sum of the items.
+        Count, ///< The number of items.
+    };
+    Q_ENUM(Aggregation)
+
+    explicit AggregateProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The number of items of the source combined into a single item.
+     *
+     * Defaults to 10.
+     */
+    Q_PROPERTY(int bucketSize READ bucketSize WRITE setBucketSize NOTIFY bucketSizeChanged)
+    int bucketSize() const;
+    void setBucketSize(int newBucketSize);
+    Q_SIGNAL void bucketSizeChanged();
+
+    /**
+     * How the items of each bucket are combined.
+     *
+     * Defaults to Mean.
+     */
+    Q_PROPERTY(Aggregation aggregation READ aggregation WRITE setAggregation NOTIFY aggregationChanged)
+    Aggregation aggregation() const;
+    void setAggregation(Aggregation newAggregation);
+    Q_SIGNAL void aggregationChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void update();
+    void onSourceDataChanged();
+    void aggregate(int firstBucket, int lastBucket);
+
+    ChartDataSource *m_source = nullptr;
+    int m_bucketSize = 10;
+    Aggregation m_aggregation = Mean;
+
+    int m_sourceCount = 0;
+    QList<qreal> m_values;
+};
+
+#endif // AGGREGATEPROXYSOURCE_H
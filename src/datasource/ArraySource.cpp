@@ -7,6 +7,43 @@
 
 #include "ArraySource.h"
 
+#include <cstring>
+#include <limits>
+
+template<typename T>
+static double loadNumber(const void *data, int index)
+{
+    // Buffers set from C++ may not be aligned, so avoid dereferencing directly.
+    T value;
+    std::memcpy(&value, static_cast<const char *>(data) + index * sizeof(T), sizeof(T));
+    return value;
+}
+
+template<typename T>
+static void loadNumbers(const void *data, int start, int count, qreal *output)
+{
+    for (int i = 0; i < count; ++i) {
+        output[i] = loadNumber<T>(data, start + i);
+    }
+}
+
+template<typename T>
+static void findBounds(const void *data, int count, double &minimum, double &maximum)
+{
+    minimum = std::numeric_limits<double>::max();
+    maximum = std::numeric_limits<double>::lowest();
+    for (int i = 0; i < count; ++i) {
+        const auto value = loadNumber<T>(data, i);
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+}
+
+static int valueSize(ArraySource::ValueType type)
+{
+    return type == ArraySource::Float32 ? sizeof(float) : sizeof(double);
+}
+
 ArraySource::ArraySource(QObject *parent)
     : ChartDataSource(parent)
 {
@@ -14,43 +51,94 @@ ArraySource::ArraySource(QObject *parent)
 
 int ArraySource::itemCount() const
 {
-    return m_array.count();
+    return m_numbers ? m_numberCount : m_array.count();
 }
 
 QVariant ArraySource::item(int index) const
 {
-    if (m_array.isEmpty()) {
+    const auto count = itemCount();
+    if (count == 0) {
         return {};
     }
 
-    if (!m_wrap && (index < 0 || index > m_array.count() - 1)) {
+    if (!m_wrap && (index < 0 || index > count - 1)) {
         return {};
     }
 
-    return m_array.at(index % m_array.count());
+    index = ((index % count) + count) % count;
+    return m_numbers ? QVariant{number(index)} : m_array.at(index);
+}
+
+void ArraySource::readValues(int start, int count, qreal *output) const
+{
+    const auto size = itemCount();
+
+    if (m_numbers && !m_wrap) {
+        std::fill_n(output, count, 0.0);
+        const auto first = std::max(start, 0);
+        const auto last = std::min(start + count, size);
+        if (first < last) {
+            readNumbers(first, last - first, output + (first - start));
+        }
+        return;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        auto index = start + i;
+        if (m_wrap && size > 0) {
+            index = ((index % size) + size) % size;
+        }
+
+        if (index < 0 || index >= size) {
+            output[i] = 0.0;
+        } else {
+            output[i] = m_numbers ? number(index) : m_array.at(index).toDouble();
+        }
+    }
 }
 
 QVariant ArraySource::minimum() const
 {
-    auto itr = std::min_element(m_array.cbegin(), m_array.cend(), variantCompare);
-    if (itr != m_array.cend()) {
-        return *itr;
+    if (m_numbers) {
+        return m_numberMinimum;
     }
-    return QVariant{};
+
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_array.cbegin(), m_array.cend(), variantCompare);
+        if (itr != m_array.cend()) {
+            return *itr;
+        }
+        return QVariant{};
+    });
 }
 
 QVariant ArraySource::maximum() const
 {
-    auto itr = std::max_element(m_array.cbegin(), m_array.cend(), variantCompare);
-    if (itr != m_array.cend()) {
-        return *itr;
+    if (m_numbers) {
+        return m_numberMaximum;
     }
-    return QVariant{};
+
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_array.cbegin(), m_array.cend(), variantCompare);
+        if (itr != m_array.cend()) {
+            return *itr;
+        }
+        return QVariant{};
+    });
 }
 
 QVariantList ArraySource::array() const
 {
-    return m_array;
+    if (!m_numbers) {
+        return m_array;
+    }
+
+    QVariantList result;
+    result.reserve(m_numberCount);
+    for (int i = 0; i < m_numberCount; ++i) {
+        result.append(number(i));
+    }
+    return result;
 }
 
 bool ArraySource::wrap() const
@@ -60,14 +148,86 @@ bool ArraySource::wrap() const
 
 void ArraySource::setArray(const QVariantList &array)
 {
-    if (m_array == array) {
+    if (!m_numbers && m_array == array) {
         return;
     }
 
+    m_doubles.clear();
+    m_floats.clear();
+    m_buffer.clear();
+    setNumbers(nullptr, 0, Float64);
+
     m_array = array;
     Q_EMIT dataChanged();
 }
 
+QList<double> ArraySource::values() const
+{
+    if (!m_doubles.isEmpty()) {
+        return m_doubles;
+    }
+
+    QList<double> result(itemCount());
+    readNumbers(0, result.size(), result.data());
+    return result;
+}
+
+void ArraySource::setValues(const QList<double> &values)
+{
+    m_array.clear();
+    m_floats.clear();
+    m_buffer.clear();
+
+    m_doubles = values;
+    setNumbers(m_doubles.constData(), m_doubles.size(), Float64);
+    Q_EMIT dataChanged();
+}
+
+void ArraySource::setValues(const QList<float> &values)
+{
+    m_array.clear();
+    m_doubles.clear();
+    m_buffer.clear();
+
+    m_floats = values;
+    setNumbers(m_floats.constData(), m_floats.size(), Float32);
+    Q_EMIT dataChanged();
+}
+
+QByteArray ArraySource::buffer() const
+{
+    return m_buffer;
+}
+
+void ArraySource::setBuffer(const QByteArray &buffer)
+{
+    m_array.clear();
+    m_doubles.clear();
+    m_floats.clear();
+
+    m_buffer = buffer;
+    setNumbers(m_buffer.constData(), m_buffer.size() / valueSize(m_bufferType), m_bufferType);
+    Q_EMIT dataChanged();
+}
+
+ArraySource::ValueType ArraySource::bufferType() const
+{
+    return m_bufferType;
+}
+
+void ArraySource::setBufferType(ValueType type)
+{
+    if (type == m_bufferType) {
+        return;
+    }
+
+    m_bufferType = type;
+    if (!m_buffer.isEmpty()) {
+        setNumbers(m_buffer.constData(), m_buffer.size() / valueSize(m_bufferType), m_bufferType);
+    }
+    Q_EMIT dataChanged();
+}
+
 void ArraySource::setWrap(bool wrap)
 {
     if (m_wrap == wrap) {
@@ -78,4 +238,48 @@ void ArraySource::setWrap(bool wrap)
     Q_EMIT dataChanged();
 }
 
+void ArraySource::setNumbers(const void *data, int count, ValueType type)
+{
+    if (!data || count <= 0) {
+        m_numbers = nullptr;
+        m_numberCount = 0;
+        m_numberMinimum = 0.0;
+        m_numberMaximum = 0.0;
+        return;
+    }
+
+    m_numbers = data;
+    m_numberCount = count;
+    m_numberType = type;
+
+    // Determine minimum and maximum once here, rather than every time they
+    // are requested.
+    if (type == Float32) {
+        findBounds<float>(data, count, m_numberMinimum, m_numberMaximum);
+    } else {
+        findBounds<double>(data, count, m_numberMinimum, m_numberMaximum);
+    }
+}
+
+double ArraySource::number(int index) const
+{
+    return m_numberType == Float32 ? loadNumber<float>(m_numbers, index) : loadNumber<double>(m_numbers, index);
+}
+
+void ArraySource::readNumbers(int start, int count, qreal *output) const
+{
+    if (!m_numbers) {
+        for (int i = 0; i < count; ++i) {
+            output[i] = m_array.value(start + i).toDouble();
+        }
+        return;
+    }
+
+    if (m_numberType == Float32) {
+        loadNumbers<float>(m_numbers, start, count, output);
+    } else {
+        loadNumbers<double>(m_numbers, start, count, output);
+    }
+}
+
 #include "moc_ArraySource.cpp"
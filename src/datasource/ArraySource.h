@@ -8,12 +8,19 @@
 #ifndef ARRAYSOURCE_H
 #define ARRAYSOURCE_H
 
+#include <QByteArray>
+#include <QList>
 #include <QVariantList>
 
 #include "ChartDataSource.h"
 
 /**
  * A data source that provides entries of an array as data.
+ *
+ * Data can be provided either as a generic list of values using \ref array,
+ * or as a list of numbers using \ref values or \ref buffer. The latter two
+ * store the numbers directly rather than as individual QVariants, which is a
+ * lot cheaper for large arrays.
  */
 class QUICKCHARTS_EXPORT ArraySource : public ChartDataSource
 {
@@ -21,6 +28,15 @@ class QUICKCHARTS_EXPORT ArraySource : public ChartDataSource
     QML_ELEMENT
 
 public:
+    /**
+     * The type of the numbers stored in \ref buffer.
+     */
+    enum ValueType {
+        Float32, ///< 32-bit floating point numbers, like a Float32Array.
+        Float64, ///< 64-bit floating point numbers, like a Float64Array.
+    };
+    Q_ENUM(ValueType)
+
     /**
      * Constructor
      *
@@ -32,18 +48,80 @@ public:
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
 
     Q_PROPERTY(QVariantList array READ array WRITE setArray NOTIFY dataChanged)
     QVariantList array() const;
     void setArray(const QVariantList &array);
 
+    /**
+     * The array as a list of numbers.
+     *
+     * From QML, this accepts both JavaScript arrays and typed arrays. Setting
+     * this replaces any values set through \ref array or \ref buffer. The
+     * minimum and maximum are determined once when the values are set.
+     *
+     * From C++, a list of floats can be set as well. The list is stored as-is,
+     * so no copy is made if the list is not modified afterwards. Setting a
+     * list always announces a change, even if it shares its data with the
+     * current one.
+     */
+    Q_PROPERTY(QList<double> values READ values WRITE setValues NOTIFY dataChanged)
+    QList<double> values() const;
+    void setValues(const QList<double> &values);
+    void setValues(const QList<float> &values);
+
+    /**
+     * The array as raw bytes containing numbers of \ref bufferType.
+     *
+     * From QML, this accepts an ArrayBuffer, for example the `buffer` of a
+     * typed array, which is copied when it is converted. Setting this
+     * replaces any values set through \ref array or \ref values.
+     *
+     * From C++, the buffer is stored as-is, so a buffer created using
+     * QByteArray::fromRawData() can be used to avoid copying, provided the
+     * data outlives its use by this source. After changing the data, set the
+     * buffer again to announce the change; this is never ignored, even if it
+     * is the same buffer.
+     */
+    Q_PROPERTY(QByteArray buffer READ buffer WRITE setBuffer NOTIFY dataChanged)
+    QByteArray buffer() const;
+    void setBuffer(const QByteArray &buffer);
+
+    /**
+     * The type of the numbers stored in \ref buffer.
+     *
+     * Defaults to Float64.
+     */
+    Q_PROPERTY(ValueType bufferType READ bufferType WRITE setBufferType NOTIFY dataChanged)
+    ValueType bufferType() const;
+    void setBufferType(ValueType type);
+
     Q_PROPERTY(bool wrap READ wrap WRITE setWrap NOTIFY dataChanged)
     bool wrap() const;
     void setWrap(bool wrap);
 
 private:
+    void setNumbers(const void *data, int count, ValueType type);
+    double number(int index) const;
+    void readNumbers(int start, int count, qreal *output) const;
+
     QVariantList m_array;
     bool m_wrap = false;
+
+    // Storage for numbers, only one of these is used at a time.
+    QList<double> m_doubles;
+    QList<float> m_floats;
+    QByteArray m_buffer;
+    ValueType m_bufferType = Float64;
+
+    // The numbers currently in use, pointing into one of the above. When
+    // m_numbers is null, m_array is used instead.
+    const void *m_numbers = nullptr;
+    int m_numberCount = 0;
+    ValueType m_numberType = Float64;
+    double m_numberMinimum = 0.0;
+    double m_numberMaximum = 0.0;
 };
 
 #endif // ARRAYSOURCE_H
@@ -0,0 +1,232 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "AsyncProxySource.h"
+
+#include <algorithm>
+
+#include <QMutex>
+#include <QThreadPool>
+
+// Shared with running tasks, so they can deliver their result as long as the
+// source exists.
+struct AsyncProxySource::Shared {
+    QMutex mutex;
+    AsyncProxySource *owner = nullptr;
+};
+
+AsyncProxySource::AsyncProxySource(QObject *parent)
+    : ChartDataSource(parent)
+    , m_shared(std::make_shared<Shared>())
+{
+    m_shared->owner = this;
+}
+
+AsyncProxySource::~AsyncProxySource()
+{
+    // Once this returns, running tasks can no longer reach this object.
+    QMutexLocker locker(&m_shared->mutex);
+    m_shared->owner = nullptr;
+}
+
+bool AsyncProxySource::asynchronous() const
+{
+    return m_asynchronous;
+}
+
+void AsyncProxySource::setAsynchronous(bool newAsynchronous)
+{
+    if (newAsynchronous == m_asynchronous) {
+        return;
+    }
+
+    m_asynchronous = newAsynchronous;
+    Q_EMIT asynchronousChanged();
+}
+
+bool AsyncProxySource::busy() const
+{
+    return m_busy;
+}
+
+int AsyncProxySource::itemCount() const
+{
+    return m_front ? int(m_front->values.size()) : 0;
+}
+
+QVariant AsyncProxySource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    return m_front->values[index];
+}
+
+QVariant AsyncProxySource::minimum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    return m_front->minimum;
+}
+
+QVariant AsyncProxySource::maximum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    return m_front->maximum;
+}
+
+void AsyncProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, itemCount());
+    if (first < last) {
+        std::copy(m_front->values.cbegin() + first, m_front->values.cbegin() + last, output + (first - start));
+    }
+}
+
+std::unique_ptr<AsyncProxySource::Result> AsyncProxySource::createResult() const
+{
+    return std::make_unique<Result>();
+}
+
+const AsyncProxySource::Result *AsyncProxySource::result() const
+{
+    return m_front.get();
+}
+
+void AsyncProxySource::invalidate()
+{
+    if (!m_asynchronous) {
+        start();
+        return;
+    }
+
+    // Calculate once all changes made in this event loop iteration are done.
+    if (!m_startQueued) {
+        m_startQueued = true;
+        QMetaObject::invokeMethod(this, &AsyncProxySource::start, Qt::QueuedConnection);
+    }
+}
+
+std::shared_ptr<const std::vector<qreal>> AsyncProxySource::snapshot(ChartDataSource *source)
+{
+    if (!source) {
+        return std::make_shared<const std::vector<qreal>>();
+    }
+
+    auto &entry = m_snapshots[source];
+    if (entry.source != source || entry.revision != source->revision() || !entry.values) {
+        auto values = std::make_shared<std::vector<qreal>>(source->itemCount());
+        source->readValues(0, int(values->size()), values->data());
+        entry = Snapshot{source, source->revision(), std::move(values)};
+    }
+
+    // Drop snapshots of sources that no longer exist.
+    m_snapshots.removeIf([](const auto &itr) {
+        return itr.value().source.isNull();
+    });
+
+    return m_snapshots.value(source).values;
+}
+
+void AsyncProxySource::start()
+{
+    m_startQueued = false;
+
+    // Only one task runs at a time, the next one starts once it is finished.
+    if (m_running) {
+        m_pending = true;
+        return;
+    }
+
+    auto task = createTask();
+    auto result = m_back ? std::move(m_back) : std::shared_ptr<Result>(createResult());
+
+    if (!task) {
+        result->values.clear();
+        result->minimum = 0.0;
+        result->maximum = 0.0;
+        publish(std::move(result));
+        return;
+    }
+
+    if (!m_asynchronous) {
+        run(task, *result);
+        publish(std::move(result));
+        return;
+    }
+
+    m_running = true;
+    setBusy(true);
+    QThreadPool::globalInstance()->start([shared = m_shared, task = std::move(task), result = std::move(result)]() {
+        run(task, *result);
+
+        QMutexLocker locker(&shared->mutex);
+        if (shared->owner) {
+            // If the source is destroyed before this is delivered, it is
+            // discarded.
+            QMetaObject::invokeMethod(
+                shared->owner,
+                [owner = shared->owner, result]() {
+                    owner->publish(result);
+                },
+                Qt::QueuedConnection);
+        }
+    });
+}
+
+void AsyncProxySource::publish(std::shared_ptr<Result> result)
+{
+    // The previous result is no longer visible, so the next task can reuse it.
+    m_back = std::move(m_front);
+    m_front = std::move(result);
+
+    Q_EMIT dataChanged();
+
+    if (m_running) {
+        m_running = false;
+        if (m_pending) {
+            m_pending = false;
+            start();
+        }
+        setBusy(m_running);
+    }
+}
+
+void AsyncProxySource::setBusy(bool newBusy)
+{
+    if (newBusy == m_busy) {
+        return;
+    }
+
+    m_busy = newBusy;
+    Q_EMIT busyChanged();
+}
+
+void AsyncProxySource::run(const Task &task, Result &result)
+{
+    task(result);
+
+    if (result.values.empty()) {
+        result.minimum = 0.0;
+        result.maximum = 0.0;
+    } else {
+        const auto [minimum, maximum] = std::minmax_element(result.values.cbegin(), result.values.cend());
+        result.minimum = *minimum;
+        result.maximum = *maximum;
+    }
+}
+
+#include "moc_AsyncProxySource.cpp"
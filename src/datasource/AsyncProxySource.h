@@ -0,0 +1,156 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef ASYNCPROXYSOURCE_H
+#define ASYNCPROXYSOURCE_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <QHash>
+#include <QPointer>
+
+#include "ChartDataSource.h"
+
+/**
+ * Base class for proxy sources that calculate their items on a separate
+ * thread.
+ *
+ * Subclasses call invalidate() whenever their items need to be recalculated.
+ * This calls createTask() on the GUI thread, which should take an immutable
+ * snapshot of everything needed, usually using snapshot(), and return a task
+ * that calculates the items from that snapshot. The task is run using the
+ * global thread pool.
+ *
+ * Results are double buffered: the items of the source are those of the most
+ * recently finished task, until the next task finishes and its result replaces
+ * them at once, after which dataChanged() is emitted. Invalidating while a
+ * task is running runs a single new task once it is finished.
+ */
+class QUICKCHARTS_EXPORT AsyncProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Base Class")
+
+public:
+    explicit AsyncProxySource(QObject *parent = nullptr);
+    ~AsyncProxySource() override;
+
+    /**
+     * Whether to calculate items on a separate thread.
+     *
+     * If false, items are calculated on the GUI thread as soon as they are
+     * invalidated. The default is true.
+     */
+    Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY asynchronousChanged)
+    bool asynchronous() const;
+    void setAsynchronous(bool newAsynchronous);
+    Q_SIGNAL void asynchronousChanged();
+
+    /**
+     * Whether items are currently being calculated.
+     */
+    Q_PROPERTY(bool busy READ busy NOTIFY busyChanged)
+    bool busy() const;
+    Q_SIGNAL void busyChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+protected:
+    /**
+     * The result of a task.
+     *
+     * Subclasses that produce more than values can subclass this and
+     * reimplement createResult().
+     */
+    struct Result {
+        virtual ~Result() = default;
+
+        std::vector<qreal> values;
+        // Calculated from values after the task has finished.
+        qreal minimum = 0.0;
+        qreal maximum = 0.0;
+    };
+
+    /**
+     * A task calculating a result.
+     *
+     * This is run on a separate thread, so it should only use data it owns. The
+     * result passed to it may contain an older result, so its memory can be
+     * reused, which means the task should replace all of it.
+     */
+    using Task = std::function<void(Result &result)>;
+
+    /**
+     * Create a task that calculates the items.
+     *
+     * This is called on the GUI thread. Returning an empty task results in no
+     * items.
+     */
+    virtual Task createTask() = 0;
+    /**
+     * Create an empty result.
+     *
+     * The default creates a Result.
+     */
+    virtual std::unique_ptr<Result> createResult() const;
+
+    /**
+     * The result of the most recently finished task.
+     *
+     * This is nullptr until the first task has finished.
+     */
+    const Result *result() const;
+
+    /**
+     * Schedule calculating the items.
+     */
+    void invalidate();
+
+    /**
+     * A copy of the values of \p source.
+     *
+     * The copy is reused as long as the source does not change, so using this
+     * for sources that did not change is cheap.
+     */
+    std::shared_ptr<const std::vector<qreal>> snapshot(ChartDataSource *source);
+
+private:
+    struct Shared;
+
+    static void run(const Task &task, Result &result);
+    void start();
+    void publish(std::shared_ptr<Result> result);
+    void setBusy(bool newBusy);
+
+    bool m_asynchronous = true;
+    bool m_busy = false;
+    bool m_startQueued = false;
+    bool m_running = false;
+    bool m_pending = false;
+
+    // The result that is visible and the one that the next task writes to.
+    std::shared_ptr<Result> m_front;
+    std::shared_ptr<Result> m_back;
+
+    std::shared_ptr<Shared> m_shared;
+
+    struct Snapshot {
+        QPointer<ChartDataSource> source;
+        quint64 revision = 0;
+        std::shared_ptr<const std::vector<qreal>> values;
+    };
+    QHash<const ChartDataSource *, Snapshot> m_snapshots;
+};
+
+#endif // ASYNCPROXYSOURCE_H
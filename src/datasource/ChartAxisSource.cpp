@@ -27,7 +27,9 @@ QVariant ChartAxisSource::item(int index) const
     }
 
     auto range = m_chart->computedRange();
-    if (m_axis == Axis::XAxis) {
+    if (m_axis == Axis::XAxis && range.hasXValues) {
+        return range.startXValue + (range.distanceXValue / (m_itemCount - 1)) * index;
+    } else if (m_axis == Axis::XAxis) {
         return range.startX + (range.distanceX / (m_itemCount - 1)) * index;
     } else {
         return range.startY + (range.distanceY / (m_itemCount - 1)) * index;
@@ -41,7 +43,8 @@ QVariant ChartAxisSource::minimum() const
     }
 
     if (m_axis == Axis::XAxis) {
-        return m_chart->computedRange().startX;
+        const auto range = m_chart->computedRange();
+        return range.hasXValues ? QVariant{range.startXValue} : QVariant{range.startX};
     } else {
         return m_chart->computedRange().startY;
     }
@@ -54,7 +57,8 @@ QVariant ChartAxisSource::maximum() const
     }
 
     if (m_axis == Axis::XAxis) {
-        return m_chart->computedRange().endX;
+        const auto range = m_chart->computedRange();
+        return range.hasXValues ? QVariant{range.endXValue} : QVariant{range.endX};
     } else {
         return m_chart->computedRange().endY;
     }
@@ -7,12 +7,42 @@
 
 #include "ChartDataSource.h"
 
+#include <cmath>
+#include <numeric>
+
 #include <QColor>
 #include <QVariant>
 
 ChartDataSource::ChartDataSource(QObject *parent)
     : QObject(parent)
 {
+    // This is the first connection to dataChanged, so anything connected
+    // afterwards will always see the updated revision and change.
+    connect(this, &ChartDataSource::dataChanged, this, [this]() {
+        m_revision++;
+
+        if (m_hasPendingChange) {
+            const auto end = std::min(m_pendingEnd, itemCount());
+            m_lastChange = Change{m_pendingStart, std::max(end - m_pendingStart, 0), m_pendingCountDelta != 0};
+        } else {
+            m_lastChange = Change{};
+        }
+
+        m_hasPendingChange = false;
+        m_pendingCountDelta = 0;
+    });
+
+    // Inserting or removing items moves all items after them, so those are
+    // considered changed as well.
+    connect(this, &ChartDataSource::itemsChanged, this, [this](int start, int count) {
+        addPendingChange(start, start + count, 0);
+    });
+    connect(this, &ChartDataSource::itemsInserted, this, [this](int start, int count) {
+        addPendingChange(start, std::numeric_limits<int>::max(), count);
+    });
+    connect(this, &ChartDataSource::itemsRemoved, this, [this](int start, int count) {
+        addPendingChange(start, std::numeric_limits<int>::max(), -count);
+    });
 }
 
 QVariant ChartDataSource::first() const
@@ -20,6 +50,119 @@ QVariant ChartDataSource::first() const
     return item(0);
 }
 
+void ChartDataSource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        output[i] = item(start + i).toDouble();
+    }
+}
+
+bool ChartDataSource::hasXValues() const
+{
+    return false;
+}
+
+void ChartDataSource::readXValues(int start, int count, qreal *output) const
+{
+    std::iota(output, output + count, qreal(start));
+}
+
+int ChartDataSource::lowerBoundX(qreal x) const
+{
+    if (!hasXValues()) {
+        return int(std::clamp(std::ceil(x), 0.0, qreal(itemCount())));
+    }
+
+    auto first = 0;
+    auto count = itemCount();
+    while (count > 0) {
+        const auto step = count / 2;
+        qreal value = 0.0;
+        readXValues(first + step, 1, &value);
+        if (value < x) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+quint64 ChartDataSource::revision() const
+{
+    return m_revision;
+}
+
+ChartDataSource::Statistics ChartDataSource::statistics() const
+{
+    if (m_statisticsRevision == m_revision) {
+        return m_statistics;
+    }
+
+    Statistics result;
+
+    const auto count = itemCount();
+    if (count > 0) {
+        result.minimum = std::numeric_limits<qreal>::max();
+        result.maximum = std::numeric_limits<qreal>::lowest();
+
+        // Read in chunks to avoid allocating a buffer for all items of large
+        // sources.
+        constexpr int chunkSize = 1024;
+        qreal values[chunkSize];
+        for (int start = 0; start < count; start += chunkSize) {
+            const auto chunk = std::min(chunkSize, count - start);
+            readValues(start, chunk, values);
+            for (int i = 0; i < chunk; ++i) {
+                result.minimum = std::min(result.minimum, values[i]);
+                result.maximum = std::max(result.maximum, values[i]);
+                result.sum += values[i];
+            }
+        }
+    }
+
+    m_statistics = result;
+    m_statisticsRevision = m_revision;
+    return result;
+}
+
+ChartDataSource::Change ChartDataSource::lastChange() const
+{
+    return m_lastChange;
+}
+
+QVariant ChartDataSource::cachedMinimum(const std::function<QVariant()> &calculate) const
+{
+    if (m_minimum.revision != m_revision) {
+        m_minimum.value = calculate();
+        m_minimum.revision = m_revision;
+    }
+    return m_minimum.value;
+}
+
+QVariant ChartDataSource::cachedMaximum(const std::function<QVariant()> &calculate) const
+{
+    if (m_maximum.revision != m_revision) {
+        m_maximum.value = calculate();
+        m_maximum.revision = m_revision;
+    }
+    return m_maximum.value;
+}
+
+void ChartDataSource::addPendingChange(int start, int end, int countDelta)
+{
+    if (m_hasPendingChange) {
+        m_pendingStart = std::min(m_pendingStart, start);
+        m_pendingEnd = std::max(m_pendingEnd, end);
+    } else {
+        m_pendingStart = start;
+        m_pendingEnd = end;
+        m_hasPendingChange = true;
+    }
+    m_pendingCountDelta += countDelta;
+}
+
 bool ChartDataSource::variantCompare(const QVariant &lhs, const QVariant &rhs)
 {
     return QVariant::compare(lhs, rhs) == QPartialOrdering::Less;
@@ -8,13 +8,23 @@
 #ifndef DATASOURCE_H
 #define DATASOURCE_H
 
+#include <functional>
+
 #include <QObject>
+#include <QVariant>
 #include <qqmlregistration.h>
 
 #include "quickcharts_export.h"
 
 /**
  * Abstract base class for data sources.
+ *
+ * Whenever the data of a source changes, it emits dataChanged(). Sources
+ * that know which items changed can additionally emit one or more of
+ * itemsChanged(), itemsInserted() and itemsRemoved() right before emitting
+ * dataChanged(). Consumers can use these, or lastChange(), to only update
+ * what actually changed. A dataChanged() that is not preceded by any of these
+ * means everything should be considered changed.
  */
 class QUICKCHARTS_EXPORT ChartDataSource : public QObject
 {
@@ -23,6 +33,29 @@ class QUICKCHARTS_EXPORT ChartDataSource : public QObject
     QML_UNCREATABLE("Abstract Base Class")
 
 public:
+    /**
+     * Numeric aggregates over all items of a source.
+     */
+    struct Statistics {
+        qreal minimum = 0.0;
+        qreal maximum = 0.0;
+        qreal sum = 0.0;
+    };
+
+    /**
+     * Describes which items were affected by a change.
+     */
+    struct Change {
+        int start = 0; ///< The first affected item.
+        int count = -1; ///< The number of affected items, -1 if all items are affected.
+        bool itemCountChanged = true; ///< Whether the change modified itemCount().
+
+        bool isReset() const
+        {
+            return count < 0;
+        }
+    };
+
     explicit ChartDataSource(QObject *parent = nullptr);
     virtual ~ChartDataSource() = default;
 
@@ -33,10 +66,130 @@ public:
 
     virtual QVariant first() const;
 
+    /**
+     * Read a range of items as numbers.
+     *
+     * This writes \p count values, starting with item \p start, to \p output.
+     * Items that do not exist or are not numeric are written as 0.0, which
+     * matches what converting the result of item() to a number produces.
+     *
+     * The default implementation calls item() for each value. Subclasses that
+     * store their data in a way that allows cheaper access should reimplement
+     * this.
+     *
+     * \param start The index of the first item to read.
+     * \param count The number of items to read.
+     * \param output A buffer with room for at least \p count values.
+     */
+    virtual void readValues(int start, int count, qreal *output) const;
+
+    /**
+     * Whether items have an X value.
+     *
+     * By default, items do not have an X value and charts place items
+     * according to their index. Sources that provide X values should
+     * reimplement this, together with readXValues(). X values should be
+     * sorted in ascending order, so charts can find the items within their
+     * range using lowerBoundX().
+     */
+    virtual bool hasXValues() const;
+    /**
+     * Read the X values of several items.
+     *
+     * This works like readValues(). The default implementation writes the
+     * index of each item.
+     */
+    virtual void readXValues(int start, int count, qreal *output) const;
+    /**
+     * The index of the first item with an X value that is not less than \p x.
+     *
+     * This returns itemCount() if all items have a smaller X value. The
+     * default implementation uses a binary search through readXValues(), so
+     * it reads only a few X values.
+     */
+    virtual int lowerBoundX(qreal x) const;
+
+    /**
+     * A counter that is increased every time dataChanged() is emitted.
+     *
+     * Anything derived from the data of this source can store the revision it
+     * was derived from and compare it to determine whether it is still valid.
+     */
+    quint64 revision() const;
+
+    /**
+     * The minimum, maximum and sum of all items, as numbers.
+     *
+     * This is calculated using readValues() the first time it is requested
+     * after a change and cached until the next change. This means that
+     * repeated queries, including those made by different charts sharing this
+     * source, only calculate it once.
+     */
+    Statistics statistics() const;
+
+    /**
+     * Which items were affected by the most recent emission of dataChanged().
+     *
+     * This combines all itemsChanged(), itemsInserted() and itemsRemoved()
+     * signals emitted before dataChanged(), so it is valid to call from
+     * anything connected to dataChanged().
+     */
+    Change lastChange() const;
+
     Q_SIGNAL void dataChanged();
+    /**
+     * Emitted before dataChanged() when \p count items starting at \p start
+     * changed value, without changing itemCount().
+     */
+    Q_SIGNAL void itemsChanged(int start, int count);
+    /**
+     * Emitted before dataChanged() when \p count items were inserted at
+     * \p start. Appending items is reported as an insertion at the previous
+     * itemCount().
+     */
+    Q_SIGNAL void itemsInserted(int start, int count);
+    /**
+     * Emitted before dataChanged() when \p count items starting at \p start
+     * were removed.
+     */
+    Q_SIGNAL void itemsRemoved(int start, int count);
 
 protected:
     static bool variantCompare(const QVariant &lhs, const QVariant &rhs);
+
+    /**
+     * Return a cached minimum, calling \p calculate if the cache is outdated.
+     *
+     * This is intended for implementations of minimum() that need to
+     * calculate their result. The cached value remains valid until the next
+     * time dataChanged() is emitted.
+     */
+    QVariant cachedMinimum(const std::function<QVariant()> &calculate) const;
+    /**
+     * Return a cached maximum, calling \p calculate if the cache is outdated.
+     *
+     * \see cachedMinimum()
+     */
+    QVariant cachedMaximum(const std::function<QVariant()> &calculate) const;
+
+private:
+    struct CachedValue {
+        quint64 revision = 0;
+        QVariant value;
+    };
+
+    void addPendingChange(int start, int end, int countDelta);
+
+    quint64 m_revision = 1;
+    bool m_hasPendingChange = false;
+    int m_pendingStart = 0;
+    int m_pendingEnd = 0;
+    int m_pendingCountDelta = 0;
+    Change m_lastChange;
+    mutable CachedValue m_minimum;
+    mutable CachedValue m_maximum;
+    mutable quint64 m_statisticsRevision = 0;
+    mutable Statistics m_statistics;
 };
 
 #endif // DATASOURCE_H
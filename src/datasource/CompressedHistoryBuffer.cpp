@@ -0,0 +1,357 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "CompressedHistoryBuffer.h"
+
+#include <algorithm>
+#include <bit>
+
+static quint64 mask(int bits)
+{
+    return bits >= 64 ? ~quint64(0) : (quint64(1) << bits) - 1;
+}
+
+namespace
+{
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<quint64> &words)
+        : m_words(words)
+    {
+    }
+
+    // Write the lowest bits of value, most significant bit first.
+    void write(quint64 value, int bits)
+    {
+        while (bits > 0) {
+            if (m_used == 64) {
+                m_words.push_back(0);
+                m_used = 0;
+            }
+
+            const auto count = std::min(bits, 64 - m_used);
+            const auto chunk = (value >> (bits - count)) & mask(count);
+            m_words.back() |= chunk << (64 - m_used - count);
+            m_used += count;
+            bits -= count;
+        }
+    }
+
+private:
+    std::vector<quint64> &m_words;
+    int m_used = 64;
+};
+
+class BitReader
+{
+public:
+    explicit BitReader(const std::vector<quint64> &words)
+        : m_words(words)
+    {
+    }
+
+    quint64 read(int bits)
+    {
+        quint64 result = 0;
+        while (bits > 0) {
+            const auto count = std::min(bits, 64 - m_used);
+            const auto chunk = (m_words[m_word] >> (64 - m_used - count)) & mask(count);
+            result = count == 64 ? chunk : (result << count) | chunk;
+            m_used += count;
+            bits -= count;
+            if (m_used == 64) {
+                m_word++;
+                m_used = 0;
+            }
+        }
+        return result;
+    }
+
+private:
+    const std::vector<quint64> &m_words;
+    std::size_t m_word = 0;
+    int m_used = 0;
+};
+}
+
+// Each value is XORed with the previous one. Identical values are stored as a
+// single 0 bit. Otherwise only the bits between the leading and trailing zeros
+// of the XOR are stored, reusing the leading and trailing zero counts of the
+// previous value if its range of bits contains the new one.
+static std::vector<quint64> encode(const std::vector<double> &values)
+{
+    std::vector<quint64> words;
+    BitWriter writer(words);
+
+    auto previous = std::bit_cast<quint64>(values.front());
+    writer.write(previous, 64);
+
+    int leading = -1;
+    int trailing = 0;
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        const auto current = std::bit_cast<quint64>(values[i]);
+        const auto difference = current ^ previous;
+        previous = current;
+
+        if (difference == 0) {
+            writer.write(0, 1);
+            continue;
+        }
+
+        writer.write(1, 1);
+
+        // The leading zero count is stored in 5 bits.
+        const auto currentLeading = std::min(std::countl_zero(difference), 31);
+        const auto currentTrailing = std::countr_zero(difference);
+        if (leading >= 0 && currentLeading >= leading && currentTrailing >= trailing) {
+            writer.write(0, 1);
+            writer.write(difference >> trailing, 64 - leading - trailing);
+        } else {
+            leading = currentLeading;
+            trailing = currentTrailing;
+            const auto length = 64 - leading - trailing;
+            writer.write(1, 1);
+            writer.write(leading, 5);
+            writer.write(length - 1, 6);
+            writer.write(difference >> trailing, length);
+        }
+    }
+
+    words.shrink_to_fit();
+    return words;
+}
+
+static void decode(const std::vector<quint64> &words, int count, std::vector<double> &output)
+{
+    output.resize(count);
+    if (count == 0) {
+        return;
+    }
+
+    BitReader reader(words);
+
+    auto previous = reader.read(64);
+    output[0] = std::bit_cast<double>(previous);
+
+    int leading = 0;
+    int trailing = 0;
+    for (int i = 1; i < count; ++i) {
+        if (reader.read(1) != 0) {
+            if (reader.read(1) != 0) {
+                leading = int(reader.read(5));
+                trailing = 64 - leading - (int(reader.read(6)) + 1);
+            }
+            previous ^= reader.read(64 - leading - trailing) << trailing;
+        }
+        output[i] = std::bit_cast<double>(previous);
+    }
+}
+
+CompressedHistoryBuffer::CompressedHistoryBuffer(int capacity)
+    : m_capacity(std::max(capacity, 0))
+{
+}
+
+int CompressedHistoryBuffer::capacity() const
+{
+    return m_capacity;
+}
+
+void CompressedHistoryBuffer::setCapacity(int capacity)
+{
+    // Values are stored by sequence number rather than position, so changing
+    // the capacity only needs to drop values that no longer fit.
+    m_capacity = std::max(capacity, 0);
+    m_size = std::min(m_size, m_capacity);
+    dropExpired();
+}
+
+int CompressedHistoryBuffer::size() const
+{
+    return m_size;
+}
+
+bool CompressedHistoryBuffer::isEmpty() const
+{
+    return m_size == 0;
+}
+
+void CompressedHistoryBuffer::push(double value)
+{
+    if (m_capacity == 0) {
+        return;
+    }
+
+    if (m_open.empty()) {
+        m_open.reserve(BlockSize);
+        m_openMinimum = value;
+        m_openMaximum = value;
+    } else {
+        m_openMinimum = std::min(m_openMinimum, value);
+        m_openMaximum = std::max(m_openMaximum, value);
+    }
+    m_open.push_back(value);
+
+    m_sequence++;
+    m_size = std::min(m_size + 1, m_capacity);
+
+    if (int(m_open.size()) == BlockSize) {
+        seal();
+    }
+
+    dropExpired();
+}
+
+void CompressedHistoryBuffer::clear()
+{
+    m_size = 0;
+    m_blocks.clear();
+    m_open.clear();
+    m_decodedStart = std::numeric_limits<quint64>::max();
+    m_decoded.clear();
+}
+
+double CompressedHistoryBuffer::at(int index) const
+{
+    Q_ASSERT(index >= 0 && index < m_size);
+    const auto sequence = m_sequence - 1 - index;
+    const auto values = segment(sequence);
+    return values.values[sequence - values.start];
+}
+
+void CompressedHistoryBuffer::read(int start, int count, qreal *output) const
+{
+    Q_ASSERT(start >= 0 && start + count <= m_size);
+
+    // Values are stored oldest to newest, so read each segment backwards,
+    // decoding each block only once.
+    int i = 0;
+    while (i < count) {
+        const auto sequence = m_sequence - 1 - quint64(start + i);
+        const auto values = segment(sequence);
+        const auto available = std::min(int(sequence - values.start) + 1, count - i);
+        for (int j = 0; j < available; ++j) {
+            output[i + j] = values.values[sequence - values.start - j];
+        }
+        i += available;
+    }
+}
+
+double CompressedHistoryBuffer::minimum() const
+{
+    if (m_size == 0) {
+        return 0.0;
+    }
+
+    const auto oldest = m_sequence - m_size;
+    const auto openStart = m_sequence - m_open.size();
+
+    auto result = std::numeric_limits<double>::max();
+    for (const auto &block : m_blocks) {
+        if (block.start >= oldest) {
+            result = std::min(result, block.minimum);
+        } else {
+            const auto &values = decode(block);
+            result = std::min(result, *std::min_element(values.cbegin() + (oldest - block.start), values.cend()));
+        }
+    }
+
+    if (!m_open.empty()) {
+        if (openStart >= oldest) {
+            result = std::min(result, m_openMinimum);
+        } else {
+            result = std::min(result, *std::min_element(m_open.cbegin() + (oldest - openStart), m_open.cend()));
+        }
+    }
+
+    return result;
+}
+
+double CompressedHistoryBuffer::maximum() const
+{
+    if (m_size == 0) {
+        return 0.0;
+    }
+
+    const auto oldest = m_sequence - m_size;
+    const auto openStart = m_sequence - m_open.size();
+
+    auto result = std::numeric_limits<double>::lowest();
+    for (const auto &block : m_blocks) {
+        if (block.start >= oldest) {
+            result = std::max(result, block.maximum);
+        } else {
+            const auto &values = decode(block);
+            result = std::max(result, *std::max_element(values.cbegin() + (oldest - block.start), values.cend()));
+        }
+    }
+
+    if (!m_open.empty()) {
+        if (openStart >= oldest) {
+            result = std::max(result, m_openMaximum);
+        } else {
+            result = std::max(result, *std::max_element(m_open.cbegin() + (oldest - openStart), m_open.cend()));
+        }
+    }
+
+    return result;
+}
+
+std::size_t CompressedHistoryBuffer::memoryUsage() const
+{
+    auto result = m_open.capacity() * sizeof(double) + m_decoded.capacity() * sizeof(double);
+    for (const auto &block : m_blocks) {
+        result += sizeof(Block) + block.bits.capacity() * sizeof(quint64);
+    }
+    return result;
+}
+
+CompressedHistoryBuffer::Segment CompressedHistoryBuffer::segment(quint64 sequence) const
+{
+    const auto openStart = m_sequence - m_open.size();
+    if (sequence >= openStart) {
+        return Segment{openStart, m_open.data()};
+    }
+
+    // Blocks are consecutive, so the block can be found directly.
+    const auto &block = m_blocks[(sequence - m_blocks.front().start) / BlockSize];
+    return Segment{block.start, decode(block).data()};
+}
+
+const std::vector<double> &CompressedHistoryBuffer::decode(const Block &block) const
+{
+    if (block.start != m_decodedStart) {
+        ::decode(block.bits, BlockSize, m_decoded);
+        m_decodedStart = block.start;
+    }
+    return m_decoded;
+}
+
+void CompressedHistoryBuffer::seal()
+{
+    Block block;
+    block.start = m_sequence - m_open.size();
+    block.bits = encode(m_open);
+    block.minimum = m_openMinimum;
+    block.maximum = m_openMaximum;
+    m_blocks.push_back(std::move(block));
+
+    m_open.clear();
+}
+
+void CompressedHistoryBuffer::dropExpired()
+{
+    const auto oldest = m_sequence - m_size;
+    while (!m_blocks.empty() && m_blocks.front().start + BlockSize <= oldest) {
+        m_blocks.pop_front();
+    }
+
+    if (m_size == 0) {
+        m_open.clear();
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef COMPRESSEDHISTORYBUFFER_H
+#define COMPRESSEDHISTORYBUFFER_H
+
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include <QtGlobal>
+
+/**
+ * A fixed-capacity buffer of values that stores its values compressed.
+ *
+ * This behaves like HistoryBuffer, but groups values into blocks of BlockSize
+ * values that are compressed once they are full. Values are compressed by
+ * storing only the bits that differ from the previous value, like the
+ * floating point compression of Facebook's Gorilla time series database. For
+ * values that change slowly or are often repeated, this uses one to three
+ * bytes per value instead of eight.
+ *
+ * Reading a value only decompresses the block that contains it, and the most
+ * recently decompressed block is kept, so reading consecutive values does not
+ * decompress anything again. The minimum and maximum of each block are stored
+ * alongside it, so querying the minimum and maximum only needs to decompress
+ * the oldest block, if it is partially dropped.
+ *
+ * The most recent block is stored uncompressed until it is full, so this is
+ * only useful for capacities of several blocks.
+ */
+class CompressedHistoryBuffer
+{
+public:
+    static constexpr int BlockSize = 1024;
+
+    explicit CompressedHistoryBuffer(int capacity = 0);
+
+    /**
+     * The maximum number of values stored.
+     *
+     * Reducing the capacity drops the oldest values.
+     */
+    int capacity() const;
+    void setCapacity(int capacity);
+
+    int size() const;
+    bool isEmpty() const;
+
+    /**
+     * Add a value at the front, dropping the oldest value if full.
+     */
+    void push(double value);
+    /**
+     * Remove all values.
+     */
+    void clear();
+
+    /**
+     * The value at \p index, where 0 is the most recent value.
+     *
+     * \p index must be a valid index.
+     */
+    double at(int index) const;
+    /**
+     * Copy \p count values, starting at \p start, to \p output.
+     *
+     * The range must be within the buffer.
+     */
+    void read(int start, int count, qreal *output) const;
+
+    /**
+     * The smallest value in the buffer, or 0 if it is empty.
+     */
+    double minimum() const;
+    /**
+     * The largest value in the buffer, or 0 if it is empty.
+     */
+    double maximum() const;
+
+    /**
+     * The approximate number of bytes used to store the values.
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    struct Block {
+        // The sequence number of the first value of the block.
+        quint64 start;
+        std::vector<quint64> bits;
+        double minimum;
+        double maximum;
+    };
+
+    // A segment of consecutive values, oldest first.
+    struct Segment {
+        quint64 start;
+        const double *values;
+    };
+
+    Segment segment(quint64 sequence) const;
+    const std::vector<double> &decode(const Block &block) const;
+    void seal();
+    void dropExpired();
+
+    int m_capacity = 0;
+    int m_size = 0;
+    // The sequence number of the next value pushed.
+    quint64 m_sequence = 0;
+
+    // Full blocks, oldest first.
+    std::deque<Block> m_blocks;
+    // The values of the block being filled.
+    std::vector<double> m_open;
+    double m_openMinimum = 0.0;
+    double m_openMaximum = 0.0;
+
+    mutable quint64 m_decodedStart = std::numeric_limits<quint64>::max();
+    mutable std::vector<double> m_decoded;
+};
+
+#endif // COMPRESSEDHISTORYBUFFER_H
@@ -0,0 +1,317 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "DecimationProxySource.h"
+
+#include <cmath>
+#include <vector>
+
+DecimationProxySource::DecimationProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &DecimationProxySource::sourceChanged, this, &DecimationProxySource::update);
+    connect(this, &DecimationProxySource::maximumItemsChanged, this, &DecimationProxySource::update);
+    connect(this, &DecimationProxySource::modeChanged, this, &DecimationProxySource::update);
+}
+
+ChartDataSource *DecimationProxySource::source() const
+{
+    return m_source;
+}
+
+void DecimationProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &DecimationProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int DecimationProxySource::maximumItems() const
+{
+    return m_maximumItems;
+}
+
+void DecimationProxySource::setMaximumItems(int newMaximumItems)
+{
+    if (newMaximumItems == m_maximumItems) {
+        return;
+    }
+
+    m_maximumItems = newMaximumItems;
+    Q_EMIT maximumItemsChanged();
+}
+
+DecimationProxySource::Mode DecimationProxySource::mode() const
+{
+    return m_mode;
+}
+
+void DecimationProxySource::setMode(Mode newMode)
+{
+    if (newMode == m_mode) {
+        return;
+    }
+
+    m_mode = newMode;
+    Q_EMIT modeChanged();
+}
+
+int DecimationProxySource::sourceIndex(int index) const
+{
+    if (index < 0 || index >= m_indices.size()) {
+        return -1;
+    }
+
+    return m_indices.at(index);
+}
+
+int DecimationProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant DecimationProxySource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant DecimationProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant DecimationProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void DecimationProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_values.size()));
+    if (first < last) {
+        std::copy(m_values.cbegin() + first, m_values.cbegin() + last, output + (first - start));
+    }
+}
+
+void DecimationProxySource::update()
+{
+    m_sourceCount = m_source ? m_source->itemCount() : 0;
+    m_bucketSize = calculateBucketSize(m_sourceCount);
+    m_indices.clear();
+    m_values.clear();
+
+    if (m_source) {
+        decimate(0);
+    }
+
+    Q_EMIT dataChanged();
+}
+
+void DecimationProxySource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+
+    // Appending items to the source only affects the buckets at the end, as
+    // long as the bucket size remains the same. Anything else requires
+    // recalculating everything.
+    const auto appended = !change.isReset() && change.itemCountChanged && change.start == m_sourceCount && count > m_sourceCount;
+    if (!appended || m_sourceCount == 0 || calculateBucketSize(count) != m_bucketSize) {
+        update();
+        return;
+    }
+
+    // The bucket that contained the previous last item is now different. For
+    // LargestTriangleThreeBuckets, the item selected from the bucket before it
+    // depends on its contents, so that needs to be recalculated as well.
+    auto bucket = 0;
+    if (m_mode == LargestTriangleThreeBuckets) {
+        bucket = std::max((m_sourceCount - 2) / m_bucketSize - 1, 0);
+    } else {
+        bucket = (m_sourceCount - 1) / m_bucketSize;
+    }
+
+    const auto previousCount = int(m_values.size());
+    m_sourceCount = count;
+    const auto first = decimate(bucket);
+    const auto newCount = int(m_values.size());
+
+    const auto common = std::min(previousCount, newCount);
+    if (common > first) {
+        Q_EMIT itemsChanged(first, common - first);
+    }
+    if (newCount > previousCount) {
+        Q_EMIT itemsInserted(previousCount, newCount - previousCount);
+    } else if (newCount < previousCount) {
+        Q_EMIT itemsRemoved(newCount, previousCount - newCount);
+    }
+    Q_EMIT dataChanged();
+}
+
+int DecimationProxySource::effectiveMaximumItems() const
+{
+    // LargestTriangleThreeBuckets needs at least one bucket in addition to the
+    // first and last item, MinMax needs room for one bucket.
+    return std::max(m_maximumItems, m_mode == LargestTriangleThreeBuckets ? 3 : 2);
+}
+
+int DecimationProxySource::calculateBucketSize(int count) const
+{
+    const auto maximumItems = effectiveMaximumItems();
+    if (count <= maximumItems) {
+        return 1;
+    }
+
+    qint64 bucketCount = 0;
+    qint64 bucketItems = 0;
+    if (m_mode == LargestTriangleThreeBuckets) {
+        bucketCount = maximumItems - 2;
+        bucketItems = count - 2;
+    } else {
+        bucketCount = maximumItems / 2;
+        bucketItems = count;
+    }
+
+    // Use a power of two so the bucket size only changes when the source has
+    // doubled in size.
+    qint64 bucketSize = 1;
+    while (bucketSize * bucketCount < bucketItems) {
+        bucketSize *= 2;
+    }
+    return bucketSize;
+}
+
+int DecimationProxySource::decimate(int fromBucket)
+{
+    const auto count = m_sourceCount;
+
+    // LargestTriangleThreeBuckets always includes the first and last item, so
+    // the buckets only contain the items in between.
+    const auto lttb = m_mode == LargestTriangleThreeBuckets;
+    const auto bucketsStart = lttb ? 1 : 0;
+    const auto bucketsEnd = lttb ? count - 1 : count;
+    const auto start = bucketsStart + fromBucket * m_bucketSize;
+
+    // Drop everything that was produced from the buckets that are recalculated.
+    const auto keep = int(std::lower_bound(m_indices.cbegin(), m_indices.cend(), start) - m_indices.cbegin());
+    m_indices.resize(keep);
+    m_values.resize(keep);
+
+    const auto readStart = m_indices.isEmpty() ? 0 : start;
+    if (readStart >= count) {
+        return keep;
+    }
+
+    std::vector<qreal> values(count - readStart);
+    m_source->readValues(readStart, int(values.size()), values.data());
+    auto value = [&values, readStart](int index) {
+        return values[index - readStart];
+    };
+
+    if (lttb && m_indices.isEmpty()) {
+        append(0, value(0));
+    }
+
+    for (auto bucketStart = std::max(start, bucketsStart); bucketStart < bucketsEnd; bucketStart += m_bucketSize) {
+        const auto bucketEnd = std::min(bucketStart + m_bucketSize, bucketsEnd);
+
+        if (lttb) {
+            // The third point of the triangle is the average of the next
+            // bucket, or the last item if there is no next bucket.
+            qreal nextX = count - 1;
+            qreal nextY = value(count - 1);
+            if (bucketEnd < bucketsEnd) {
+                const auto nextEnd = std::min(bucketEnd + m_bucketSize, bucketsEnd);
+                nextY = 0.0;
+                for (int i = bucketEnd; i < nextEnd; ++i) {
+                    nextY += value(i);
+                }
+                nextY /= nextEnd - bucketEnd;
+                nextX = (bucketEnd + nextEnd - 1) / 2.0;
+            }
+
+            const qreal previousX = m_indices.last();
+            const qreal previousY = m_values.last();
+
+            auto selected = bucketStart;
+            auto largestArea = -1.0;
+            for (int i = bucketStart; i < bucketEnd; ++i) {
+                const auto area = std::abs((previousX - nextX) * (value(i) - previousY) - (previousX - i) * (nextY - previousY));
+                if (area > largestArea) {
+                    largestArea = area;
+                    selected = i;
+                }
+            }
+            append(selected, value(selected));
+        } else {
+            auto minimum = bucketStart;
+            auto maximum = bucketStart;
+            for (int i = bucketStart + 1; i < bucketEnd; ++i) {
+                if (value(i) < value(minimum)) {
+                    minimum = i;
+                }
+                if (value(i) > value(maximum)) {
+                    maximum = i;
+                }
+            }
+
+            if (minimum == maximum) {
+                append(minimum, value(minimum));
+            } else {
+                append(std::min(minimum, maximum), value(std::min(minimum, maximum)));
+                append(std::max(minimum, maximum), value(std::max(minimum, maximum)));
+            }
+        }
+    }
+
+    if (lttb && count > 1) {
+        append(count - 1, value(count - 1));
+    }
+
+    return keep;
+}
+
+void DecimationProxySource::append(int index, qreal value)
+{
+    m_indices.append(index);
+    m_values.append(value);
+}
+
+#include "moc_DecimationProxySource.cpp"
@@ -0,0 +1,125 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef DECIMATIONPROXYSOURCE_H
+#define DECIMATIONPROXYSOURCE_H
+
+#include <QList>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that reduces the number of items of a different data source.
+ *
+ * This source reads the items of another source and outputs at most
+ * \ref maximumItems items that represent the shape of the original data. This
+ * is useful to draw sources with many more items than there are pixels
+ * available, as the amount of work needed to render a chart is proportional to
+ * the number of items.
+ *
+ * The items of the source are divided into buckets of equal size, which are
+ * reduced to one or two items each depending on \ref mode. The bucket size is
+ * always a power of two, so it only changes when the number of items of the
+ * source doubles. When items are appended to the source, only the last few
+ * buckets are recalculated.
+ *
+ * Note that items of this source are evenly spaced when used with a chart, so
+ * items are placed up to one bucket away from their original position.
+ * \ref sourceIndex can be used to determine the original position of an item.
+ */
+class QUICKCHARTS_EXPORT DecimationProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * The method used to reduce the items of each bucket.
+     */
+    enum Mode {
+        /**
+         * Select the item from each bucket that forms the largest triangle with
+         * the item selected from the previous bucket and the average of the
+         * next bucket. The first and last items are always included. This
+         * preserves the visual shape of the data well, using one item per
+         * bucket.
+         */
+        LargestTriangleThreeBuckets,
+        /**
+         * Select the smallest and largest item from each bucket, in their
+         * original order. This preserves all peaks of the data, using two
+         * items per bucket.
+         */
+        MinMax,
+    };
+    Q_ENUM(Mode)
+
+    explicit DecimationProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The maximum number of items this source provides.
+     *
+     * If the source has fewer items than this, all items are used as-is. This
+     * should usually be set to the width of the chart in pixels or a bit more.
+     *
+     * Defaults to 1000.
+     */
+    Q_PROPERTY(int maximumItems READ maximumItems WRITE setMaximumItems NOTIFY maximumItemsChanged)
+    int maximumItems() const;
+    void setMaximumItems(int newMaximumItems);
+    Q_SIGNAL void maximumItemsChanged();
+
+    /**
+     * The method used to reduce the items.
+     *
+     * Defaults to LargestTriangleThreeBuckets.
+     */
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY modeChanged)
+    Mode mode() const;
+    void setMode(Mode newMode);
+    Q_SIGNAL void modeChanged();
+
+    /**
+     * The index of the item of \ref source that is used for \p index.
+     *
+     * Returns -1 if \p index is not a valid item of this source.
+     */
+    Q_INVOKABLE int sourceIndex(int index) const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void update();
+    void onSourceDataChanged();
+    int effectiveMaximumItems() const;
+    int calculateBucketSize(int count) const;
+    int decimate(int fromBucket);
+    void append(int index, qreal value);
+
+    ChartDataSource *m_source = nullptr;
+    int m_maximumItems = 1000;
+    Mode m_mode = LargestTriangleThreeBuckets;
+
+    int m_sourceCount = 0;
+    int m_bucketSize = 1;
+    QList<int> m_indices;
+    QList<qreal> m_values;
+};
+
+#endif // DECIMATIONPROXYSOURCE_H
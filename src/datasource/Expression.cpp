@@ -0,0 +1,466 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "Expression.h"
+
+#include <algorithm>
+#include <cmath>
+
+// The number of values each instruction processes at a time. The stack of
+// blocks of a typical expression fits into the L1 cache.
+static constexpr int BlockSize = 256;
+
+// A recursive descent parser for the grammar:
+//
+//   expression := term (('+' | '-') term)*
+//   term       := unary (('*' | '/') unary)*
+//   unary      := ('-' | '+') unary | primary
+//   primary    := number | variable | function '(' arguments ')' | '(' expression ')'
+class Expression::Parser
+{
+public:
+    Parser(const QString &text, const QStringList &variables)
+        : m_text(text)
+        , m_variables(variables)
+    {
+    }
+
+    bool parse()
+    {
+        if (!expression()) {
+            return false;
+        }
+
+        skipSpace();
+        if (m_position < m_text.size()) {
+            return error(QStringLiteral("Unexpected '%1'").arg(m_text.at(m_position)));
+        }
+
+        return true;
+    }
+
+    std::vector<Instruction> code;
+    int maximumDepth = 0;
+    QString errorString;
+
+private:
+    bool expression()
+    {
+        if (!term()) {
+            return false;
+        }
+
+        while (true) {
+            if (accept(u'+')) {
+                if (!term()) {
+                    return false;
+                }
+                add(OpCode::Add);
+            } else if (accept(u'-')) {
+                if (!term()) {
+                    return false;
+                }
+                add(OpCode::Subtract);
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool term()
+    {
+        if (!unary()) {
+            return false;
+        }
+
+        while (true) {
+            if (accept(u'*')) {
+                if (!unary()) {
+                    return false;
+                }
+                add(OpCode::Multiply);
+            } else if (accept(u'/')) {
+                if (!unary()) {
+                    return false;
+                }
+                add(OpCode::Divide);
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool unary()
+    {
+        if (accept(u'-')) {
+            if (!unary()) {
+                return false;
+            }
+            add(OpCode::Negate);
+            return true;
+        }
+
+        if (accept(u'+')) {
+            return unary();
+        }
+
+        return primary();
+    }
+
+    bool primary()
+    {
+        skipSpace();
+        if (m_position >= m_text.size()) {
+            return error(QStringLiteral("Unexpected end of expression"));
+        }
+
+        if (accept(u'(')) {
+            if (!expression()) {
+                return false;
+            }
+            return expect(u')');
+        }
+
+        const auto character = m_text.at(m_position);
+        if (character.isDigit() || character == u'.') {
+            return number();
+        }
+
+        if (character.isLetter() || character == u'_') {
+            const auto start = m_position;
+            while (m_position < m_text.size() && (m_text.at(m_position).isLetterOrNumber() || m_text.at(m_position) == u'_')) {
+                m_position++;
+            }
+            const auto name = m_text.mid(start, m_position - start);
+
+            skipSpace();
+            if (m_position < m_text.size() && m_text.at(m_position) == u'(') {
+                return function(name);
+            }
+
+            const auto variable = m_variables.indexOf(name);
+            if (variable < 0) {
+                m_position = start;
+                return error(QStringLiteral("Unknown variable '%1'").arg(name));
+            }
+            add(Instruction{OpCode::Variable, int(variable)});
+            return true;
+        }
+
+        return error(QStringLiteral("Unexpected '%1'").arg(character));
+    }
+
+    bool number()
+    {
+        const auto start = m_position;
+        auto isDigit = [this]() {
+            return m_position < m_text.size() && m_text.at(m_position).isDigit();
+        };
+
+        while (isDigit()) {
+            m_position++;
+        }
+        if (m_position < m_text.size() && m_text.at(m_position) == u'.') {
+            m_position++;
+            while (isDigit()) {
+                m_position++;
+            }
+        }
+        if (m_position < m_text.size() && (m_text.at(m_position) == u'e' || m_text.at(m_position) == u'E')) {
+            m_position++;
+            if (m_position < m_text.size() && (m_text.at(m_position) == u'+' || m_text.at(m_position) == u'-')) {
+                m_position++;
+            }
+            while (isDigit()) {
+                m_position++;
+            }
+        }
+
+        bool ok = false;
+        const auto value = QStringView(m_text).mid(start, m_position - start).toDouble(&ok);
+        if (!ok) {
+            m_position = start;
+            return error(QStringLiteral("Invalid number"));
+        }
+
+        add(Instruction{OpCode::Constant, 0, value});
+        return true;
+    }
+
+    bool function(const QString &name)
+    {
+        OpCode op;
+        int argumentCount = 2;
+        if (name == QLatin1String("min")) {
+            op = OpCode::Minimum;
+        } else if (name == QLatin1String("max")) {
+            op = OpCode::Maximum;
+        } else if (name == QLatin1String("abs")) {
+            op = OpCode::Absolute;
+            argumentCount = 1;
+        } else {
+            return error(QStringLiteral("Unknown function '%1'").arg(name));
+        }
+
+        accept(u'(');
+        for (int i = 0; i < argumentCount; ++i) {
+            if (i > 0 && !expect(u',')) {
+                return false;
+            }
+            if (!expression()) {
+                return false;
+            }
+        }
+        if (!expect(u')')) {
+            return false;
+        }
+
+        add(op);
+        return true;
+    }
+
+    void add(OpCode op)
+    {
+        add(Instruction{op});
+    }
+
+    void add(const Instruction &instruction)
+    {
+        switch (instruction.op) {
+        case OpCode::Variable:
+        case OpCode::Constant:
+            m_depth++;
+            maximumDepth = std::max(maximumDepth, m_depth);
+            code.push_back(instruction);
+            return;
+        case OpCode::Negate:
+        case OpCode::Absolute:
+            if (code.back().op == OpCode::Constant) {
+                code.back().constant = apply(instruction.op, code.back().constant, 0.0);
+            } else {
+                code.push_back(instruction);
+            }
+            return;
+        default:
+            m_depth--;
+            // Both operands are the last two instructions only if they are
+            // constants, as any other operand ends with an operator.
+            const auto size = code.size();
+            if (size >= 2 && code[size - 1].op == OpCode::Constant && code[size - 2].op == OpCode::Constant) {
+                code[size - 2].constant = apply(instruction.op, code[size - 2].constant, code[size - 1].constant);
+                code.pop_back();
+            } else {
+                code.push_back(instruction);
+            }
+            return;
+        }
+    }
+
+    static qreal apply(OpCode op, qreal a, qreal b)
+    {
+        switch (op) {
+        case OpCode::Add:
+            return a + b;
+        case OpCode::Subtract:
+            return a - b;
+        case OpCode::Multiply:
+            return a * b;
+        case OpCode::Divide:
+            return a / b;
+        case OpCode::Negate:
+            return -a;
+        case OpCode::Minimum:
+            return std::min(a, b);
+        case OpCode::Maximum:
+            return std::max(a, b);
+        case OpCode::Absolute:
+            return std::abs(a);
+        default:
+            return 0.0;
+        }
+    }
+
+    void skipSpace()
+    {
+        while (m_position < m_text.size() && m_text.at(m_position).isSpace()) {
+            m_position++;
+        }
+    }
+
+    bool accept(char16_t character)
+    {
+        skipSpace();
+        if (m_position < m_text.size() && m_text.at(m_position) == character) {
+            m_position++;
+            return true;
+        }
+        return false;
+    }
+
+    bool expect(char16_t character)
+    {
+        if (accept(character)) {
+            return true;
+        }
+
+        if (m_position >= m_text.size()) {
+            return error(QStringLiteral("Expected '%1' at end of expression").arg(QChar(character)));
+        }
+        return error(QStringLiteral("Expected '%1'").arg(QChar(character)));
+    }
+
+    bool error(const QString &message)
+    {
+        // Only report the first error.
+        if (errorString.isEmpty()) {
+            errorString = QStringLiteral("%1 at position %2").arg(message).arg(m_position);
+        }
+        return false;
+    }
+
+    const QString &m_text;
+    const QStringList &m_variables;
+    qsizetype m_position = 0;
+    int m_depth = 0;
+};
+
+bool Expression::parse(const QString &text, const QStringList &variables)
+{
+    m_code.clear();
+    m_usedVariables.assign(variables.size(), false);
+    m_stackSize = 0;
+    m_errorString.clear();
+
+    Parser parser(text, variables);
+    if (!parser.parse()) {
+        m_errorString = parser.errorString;
+        return false;
+    }
+
+    m_code = std::move(parser.code);
+    m_stackSize = parser.maximumDepth;
+    for (const auto &instruction : m_code) {
+        if (instruction.op == OpCode::Variable) {
+            m_usedVariables[instruction.variable] = true;
+        }
+    }
+    return true;
+}
+
+bool Expression::isValid() const
+{
+    return !m_code.empty();
+}
+
+QString Expression::errorString() const
+{
+    return m_errorString;
+}
+
+bool Expression::usesVariable(int variable) const
+{
+    return variable >= 0 && variable < int(m_usedVariables.size()) && m_usedVariables[variable];
+}
+
+template<typename Function>
+static void binary(const qreal **stack, int &depth, qreal *blocks, int count, Function function)
+{
+    const auto a = stack[depth - 2];
+    const auto b = stack[depth - 1];
+    // The result replaces the first operand, which may be the same block.
+    const auto result = blocks + (depth - 2) * BlockSize;
+    for (int i = 0; i < count; ++i) {
+        result[i] = function(a[i], b[i]);
+    }
+    stack[depth - 2] = result;
+    depth--;
+}
+
+template<typename Function>
+static void unary(const qreal **stack, int depth, qreal *blocks, int count, Function function)
+{
+    const auto a = stack[depth - 1];
+    const auto result = blocks + (depth - 1) * BlockSize;
+    for (int i = 0; i < count; ++i) {
+        result[i] = function(a[i]);
+    }
+    stack[depth - 1] = result;
+}
+
+void Expression::evaluate(int count, const qreal *const *inputs, qreal *output) const
+{
+    if (m_code.empty()) {
+        std::fill_n(output, count, 0.0);
+        return;
+    }
+
+    // Each stack entry points either directly at the values of a variable or
+    // at the block of that entry, so variables are never copied.
+    std::vector<qreal> blocks(m_stackSize * BlockSize);
+    std::vector<const qreal *> stack(m_stackSize);
+
+    for (int offset = 0; offset < count; offset += BlockSize) {
+        const auto blockCount = std::min(BlockSize, count - offset);
+
+        int depth = 0;
+        for (const auto &instruction : m_code) {
+            switch (instruction.op) {
+            case OpCode::Variable:
+                stack[depth++] = inputs[instruction.variable] + offset;
+                break;
+            case OpCode::Constant: {
+                const auto block = blocks.data() + depth * BlockSize;
+                std::fill_n(block, blockCount, instruction.constant);
+                stack[depth++] = block;
+                break;
+            }
+            case OpCode::Add:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return a + b;
+                });
+                break;
+            case OpCode::Subtract:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return a - b;
+                });
+                break;
+            case OpCode::Multiply:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return a * b;
+                });
+                break;
+            case OpCode::Divide:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return a / b;
+                });
+                break;
+            case OpCode::Minimum:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return b < a ? b : a;
+                });
+                break;
+            case OpCode::Maximum:
+                binary(stack.data(), depth, blocks.data(), blockCount, [](qreal a, qreal b) {
+                    return a < b ? b : a;
+                });
+                break;
+            case OpCode::Negate:
+                unary(stack.data(), depth, blocks.data(), blockCount, [](qreal a) {
+                    return -a;
+                });
+                break;
+            case OpCode::Absolute:
+                unary(stack.data(), depth, blocks.data(), blockCount, [](qreal a) {
+                    return std::abs(a);
+                });
+                break;
+            }
+        }
+
+        std::copy_n(stack[0], blockCount, output + offset);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <vector>
+
+#include <QString>
+#include <QStringList>
+
+/**
+ * A compiled arithmetic expression that is evaluated for arrays of values.
+ *
+ * Expressions consist of numbers, variables, the operators +, -, * and /,
+ * parentheses and the functions min(a, b), max(a, b) and abs(a). They are
+ * parsed once into a sequence of instructions for a stack machine, folding
+ * constant parts of the expression.
+ *
+ * Rather than evaluating the instructions once per value, evaluate() runs
+ * each instruction for a block of values at a time, so each instruction is a
+ * simple loop over arrays that the compiler can vectorise and the overhead of
+ * interpreting the instructions is shared by all values in the block.
+ */
+class Expression
+{
+public:
+    /**
+     * Parse \p text, where \p variables are the names of the variables.
+     *
+     * Returns false if the expression is invalid, in which case errorString()
+     * describes the problem.
+     */
+    bool parse(const QString &text, const QStringList &variables);
+
+    bool isValid() const;
+    QString errorString() const;
+
+    /**
+     * Whether the expression uses the variable with index \p variable.
+     */
+    bool usesVariable(int variable) const;
+
+    /**
+     * Evaluate the expression for \p count sets of variables.
+     *
+     * \p inputs contains an array of \p count values for each variable, the
+     * array of a variable that is not used can be nullptr. The results are
+     * written to \p output.
+     */
+    void evaluate(int count, const qreal *const *inputs, qreal *output) const;
+
+private:
+    enum class OpCode : quint8 {
+        Variable,
+        Constant,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate,
+        Minimum,
+        Maximum,
+        Absolute,
+    };
+
+    struct Instruction {
+        OpCode op;
+        // The index of the variable, for Variable.
+        int variable = 0;
+        // The value, for Constant.
+        qreal constant = 0.0;
+    };
+
+    class Parser;
+
+    std::vector<Instruction> m_code;
+    std::vector<bool> m_usedVariables;
+    int m_stackSize = 0;
+    QString m_errorString;
+};
+
+#endif // EXPRESSION_H
@@ -0,0 +1,313 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "ExpressionProxySource.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "SeriesStore.h"
+
+#include "charts_datasource_logging.h"
+
+ExpressionProxySource::ExpressionProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &ExpressionProxySource::sourcesChanged, this, &ExpressionProxySource::update);
+    connect(this, &ExpressionProxySource::variablesChanged, this, &ExpressionProxySource::parse);
+    connect(this, &ExpressionProxySource::expressionChanged, this, &ExpressionProxySource::parse);
+}
+
+QList<ChartDataSource *> ExpressionProxySource::sources() const
+{
+    return m_sources;
+}
+
+void ExpressionProxySource::setSources(const QList<ChartDataSource *> &newSources)
+{
+    if (newSources == m_sources) {
+        return;
+    }
+
+    for (auto source : std::as_const(m_sources)) {
+        if (!source) {
+            continue;
+        }
+
+        source->disconnect(this);
+        if (auto series = qobject_cast<SeriesStoreSource *>(source)) {
+            series->store()->disconnect(this);
+        }
+    }
+
+    m_sources = newSources;
+    for (auto source : std::as_const(m_sources)) {
+        if (!source) {
+            continue;
+        }
+
+        // Series of a store change together, so handle all of them at once.
+        if (auto series = qobject_cast<SeriesStoreSource *>(source)) {
+            connect(series->store(), &SeriesStore::changed, this, &ExpressionProxySource::onSeriesStoreChanged, Qt::UniqueConnection);
+        } else {
+            connect(source, &ChartDataSource::dataChanged, this, [this, source]() {
+                onSourcesDataChanged({source});
+            });
+        }
+        connect(source, &QObject::destroyed, this, [this, source]() {
+            // Keep the position of the other sources, as variables refer to
+            // sources by position.
+            std::replace(m_sources.begin(), m_sources.end(), source, static_cast<ChartDataSource *>(nullptr));
+            update();
+        });
+    }
+    Q_EMIT sourcesChanged();
+}
+
+QStringList ExpressionProxySource::variables() const
+{
+    return m_variables;
+}
+
+void ExpressionProxySource::setVariables(const QStringList &newVariables)
+{
+    if (newVariables == m_variables) {
+        return;
+    }
+
+    m_variables = newVariables;
+    Q_EMIT variablesChanged();
+}
+
+QString ExpressionProxySource::expression() const
+{
+    return m_expression;
+}
+
+void ExpressionProxySource::setExpression(const QString &newExpression)
+{
+    if (newExpression == m_expression) {
+        return;
+    }
+
+    m_expression = newExpression;
+    Q_EMIT expressionChanged();
+}
+
+QString ExpressionProxySource::errorString() const
+{
+    return m_errorString;
+}
+
+int ExpressionProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant ExpressionProxySource::item(int index) const
+{
+    if (index < 0 || index >= int(m_values.size())) {
+        return QVariant{};
+    }
+
+    return m_values[index];
+}
+
+QVariant ExpressionProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant ExpressionProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void ExpressionProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_values.size()));
+    if (first < last) {
+        std::copy(m_values.cbegin() + first, m_values.cbegin() + last, output + (first - start));
+    }
+}
+
+void ExpressionProxySource::parse()
+{
+    QString error;
+    if (m_expression.trimmed().isEmpty()) {
+        m_compiled = Expression{};
+    } else if (!m_compiled.parse(m_expression, m_variables)) {
+        error = m_compiled.errorString();
+        qCWarning(DATASOURCE) << "ExpressionProxySource: Invalid expression" << m_expression << error;
+    }
+
+    if (error != m_errorString) {
+        m_errorString = error;
+        Q_EMIT errorStringChanged();
+    }
+
+    update();
+}
+
+void ExpressionProxySource::update()
+{
+    m_values.resize(sourceItemCount());
+    evaluate(0, m_values.size());
+
+    m_revisions.resize(m_sources.size());
+    for (int i = 0; i < m_sources.size(); ++i) {
+        m_revisions[i] = m_sources.at(i) ? m_sources.at(i)->revision() : 0;
+    }
+
+    Q_EMIT dataChanged();
+}
+
+void ExpressionProxySource::onSourcesDataChanged(const QList<ChartDataSource *> &sources)
+{
+    const auto previousCount = int(m_values.size());
+    const auto count = sourceItemCount();
+
+    auto outdated = false;
+    auto reset = count < previousCount;
+    auto first = std::numeric_limits<int>::max();
+    auto last = 0;
+    for (auto source : sources) {
+        // The values are still valid if they were calculated from this
+        // revision, for example because the source is used for several
+        // variables.
+        auto sourceOutdated = false;
+        for (int i = 0; i < m_sources.size(); ++i) {
+            if (m_sources.at(i) == source && m_revisions[i] != source->revision()) {
+                m_revisions[i] = source->revision();
+                sourceOutdated = true;
+            }
+        }
+        if (!sourceOutdated) {
+            continue;
+        }
+        outdated = true;
+
+        const auto change = source->lastChange();
+        if (change.isReset()) {
+            reset = true;
+        } else if (!change.itemCountChanged) {
+            first = std::min(first, change.start);
+            last = std::max(last, std::min(change.start + change.count, count));
+        } else if (change.start >= previousCount) {
+            // Items inserted or removed past the previous end only matter if
+            // they are new items of this source.
+            first = std::min(first, previousCount);
+            last = std::max(last, count);
+        } else {
+            reset = true;
+        }
+    }
+
+    if (!outdated) {
+        return;
+    }
+
+    if (reset) {
+        update();
+        return;
+    }
+
+    if (first >= last) {
+        return;
+    }
+
+    m_values.resize(count);
+    evaluate(first, last);
+
+    const auto changedEnd = std::min(last, previousCount);
+    if (changedEnd > first) {
+        Q_EMIT itemsChanged(first, changedEnd - first);
+    }
+    if (count > previousCount) {
+        Q_EMIT itemsInserted(previousCount, count - previousCount);
+    }
+    Q_EMIT dataChanged();
+}
+
+void ExpressionProxySource::onSeriesStoreChanged()
+{
+    auto store = qobject_cast<SeriesStore *>(sender());
+
+    QList<ChartDataSource *> sources;
+    for (auto source : std::as_const(m_sources)) {
+        auto series = qobject_cast<SeriesStoreSource *>(source);
+        if (series && series->store() == store && !sources.contains(source)) {
+            sources.append(source);
+        }
+    }
+
+    onSourcesDataChanged(sources);
+}
+
+int ExpressionProxySource::sourceItemCount() const
+{
+    if (!m_compiled.isValid()) {
+        return 0;
+    }
+
+    auto result = std::numeric_limits<int>::max();
+    auto hasSource = false;
+    for (int i = 0; i < std::max(int(m_sources.size()), int(m_variables.size())); ++i) {
+        const auto source = i < m_sources.size() ? m_sources.at(i) : nullptr;
+        if (!source) {
+            // Without the values of a variable, nothing can be calculated.
+            if (m_compiled.usesVariable(i)) {
+                return 0;
+            }
+            continue;
+        }
+
+        result = std::min(result, source->itemCount());
+        hasSource = true;
+    }
+
+    return hasSource ? result : 0;
+}
+
+void ExpressionProxySource::evaluate(int first, int last)
+{
+    if (first >= last) {
+        return;
+    }
+
+    const auto count = last - first;
+
+    // Only read the values of sources that are used.
+    std::vector<std::vector<qreal>> values(m_variables.size());
+    std::vector<const qreal *> inputs(m_variables.size(), nullptr);
+    for (int i = 0; i < std::min(int(m_sources.size()), int(m_variables.size())); ++i) {
+        if (m_compiled.usesVariable(i)) {
+            values[i].resize(count);
+            m_sources.at(i)->readValues(first, count, values[i].data());
+            inputs[i] = values[i].data();
+        }
+    }
+
+    m_compiled.evaluate(count, inputs.data(), m_values.data() + first);
+}
+
+#include "moc_ExpressionProxySource.cpp"
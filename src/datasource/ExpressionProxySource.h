@@ -0,0 +1,112 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef EXPRESSIONPROXYSOURCE_H
+#define EXPRESSIONPROXYSOURCE_H
+
+#include <vector>
+
+#include <QList>
+#include <QStringList>
+
+#include "ChartDataSource.h"
+#include "Expression.h"
+
+/**
+ * A data source that calculates its items from the items of other sources.
+ *
+ * Each item is the result of \ref expression for the items with the same
+ * index in \ref sources. The expression refers to the sources by the names in
+ * \ref variables, and can use numbers, the operators +, -, * and /,
+ * parentheses and the functions min(a, b), max(a, b) and abs(a).
+ *
+ * \code{.qml}
+ * ExpressionProxySource {
+ *     sources: [receivedSource, transmittedSource]
+ *     variables: ["rx", "tx"]
+ *     expression: "rx + tx"
+ * }
+ * \endcode
+ *
+ * The expression is parsed once and evaluated natively for ranges of items.
+ * When items of a source change or are appended, only the affected items are
+ * recalculated, and changes of sources that do not change their revision are
+ * ignored. Changes to several series of a SeriesStore are handled at once.
+ *
+ * The number of items is that of the source with the fewest items.
+ */
+class QUICKCHARTS_EXPORT ExpressionProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit ExpressionProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data sources used by the expression.
+     */
+    Q_PROPERTY(QList<ChartDataSource *> sources READ sources WRITE setSources NOTIFY sourcesChanged)
+    QList<ChartDataSource *> sources() const;
+    void setSources(const QList<ChartDataSource *> &newSources);
+    Q_SIGNAL void sourcesChanged();
+
+    /**
+     * The names used by the expression to refer to each source.
+     *
+     * The first name refers to the first source, and so on.
+     */
+    Q_PROPERTY(QStringList variables READ variables WRITE setVariables NOTIFY variablesChanged)
+    QStringList variables() const;
+    void setVariables(const QStringList &newVariables);
+    Q_SIGNAL void variablesChanged();
+
+    /**
+     * The expression used to calculate each item.
+     *
+     * If the expression is invalid, this source has no items and
+     * \ref errorString describes the problem.
+     */
+    Q_PROPERTY(QString expression READ expression WRITE setExpression NOTIFY expressionChanged)
+    QString expression() const;
+    void setExpression(const QString &newExpression);
+    Q_SIGNAL void expressionChanged();
+
+    /**
+     * A description of why \ref expression is invalid, or empty if it is valid.
+     */
+    Q_PROPERTY(QString errorString READ errorString NOTIFY errorStringChanged)
+    QString errorString() const;
+    Q_SIGNAL void errorStringChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void parse();
+    void update();
+    void onSourcesDataChanged(const QList<ChartDataSource *> &sources);
+    void onSeriesStoreChanged();
+    int sourceItemCount() const;
+    void evaluate(int first, int last);
+
+    QList<ChartDataSource *> m_sources;
+    QStringList m_variables;
+    QString m_expression;
+
+    Expression m_compiled;
+    QString m_errorString;
+
+    // The revision of each source the values were calculated from.
+    std::vector<quint64> m_revisions;
+    std::vector<qreal> m_values;
+};
+
+#endif // EXPRESSIONPROXYSOURCE_H
@@ -0,0 +1,394 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "HistogramSource.h"
+
+#include <cmath>
+
+#include <QSemaphore>
+#include <QThreadPool>
+
+// Sources with at least this many items are processed in parallel.
+static constexpr std::size_t parallelThreshold = 1 << 18;
+// Limits the number of bins resulting from a small binWidth.
+static constexpr int maximumBinCount = 1 << 16;
+
+static int chunkCount(std::size_t count)
+{
+    if (count < parallelThreshold) {
+        return 1;
+    }
+    return std::max(QThreadPool::globalInstance()->maxThreadCount(), 1);
+}
+
+// Call function(chunk, begin, end) for chunks of count items and wait until
+// all are done. Chunks after the first are run on the global thread pool if
+// it has a thread available, or on the current thread otherwise.
+template<typename Function>
+static void forEachChunk(std::size_t count, int chunks, Function function)
+{
+    const auto chunkSize = (count + chunks - 1) / chunks;
+
+    QSemaphore done;
+    for (int chunk = 1; chunk < chunks; ++chunk) {
+        auto task = [&function, &done, chunk, chunkSize, count]() {
+            function(chunk, std::min(chunk * chunkSize, count), std::min((chunk + 1) * chunkSize, count));
+            done.release();
+        };
+        if (!QThreadPool::globalInstance()->tryStart(task)) {
+            task();
+        }
+    }
+
+    function(0, 0, std::min(chunkSize, count));
+    done.acquire(chunks - 1);
+}
+
+HistogramSource::HistogramSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &HistogramSource::sourceChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::binCountChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::binWidthChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::fromChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::toChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::automaticChanged, this, &HistogramSource::update);
+    connect(this, &HistogramSource::scaleChanged, this, &HistogramSource::update);
+}
+
+ChartDataSource *HistogramSource::source() const
+{
+    return m_source;
+}
+
+void HistogramSource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &HistogramSource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int HistogramSource::binCount() const
+{
+    return m_binCount;
+}
+
+void HistogramSource::setBinCount(int newBinCount)
+{
+    newBinCount = std::max(newBinCount, 1);
+    if (newBinCount == m_binCount) {
+        return;
+    }
+
+    m_binCount = newBinCount;
+    Q_EMIT binCountChanged();
+}
+
+qreal HistogramSource::binWidth() const
+{
+    return m_binWidth;
+}
+
+void HistogramSource::setBinWidth(qreal newBinWidth)
+{
+    if (qFuzzyCompare(newBinWidth, m_binWidth)) {
+        return;
+    }
+
+    m_binWidth = newBinWidth;
+    Q_EMIT binWidthChanged();
+}
+
+qreal HistogramSource::from() const
+{
+    return m_from;
+}
+
+void HistogramSource::setFrom(qreal newFrom)
+{
+    if (qFuzzyCompare(newFrom, m_from)) {
+        return;
+    }
+
+    m_from = newFrom;
+    Q_EMIT fromChanged();
+}
+
+qreal HistogramSource::to() const
+{
+    return m_to;
+}
+
+void HistogramSource::setTo(qreal newTo)
+{
+    if (qFuzzyCompare(newTo, m_to)) {
+        return;
+    }
+
+    m_to = newTo;
+    Q_EMIT toChanged();
+}
+
+bool HistogramSource::automatic() const
+{
+    return m_automatic;
+}
+
+void HistogramSource::setAutomatic(bool newAutomatic)
+{
+    if (newAutomatic == m_automatic) {
+        return;
+    }
+
+    m_automatic = newAutomatic;
+    Q_EMIT automaticChanged();
+}
+
+HistogramSource::Scale HistogramSource::scale() const
+{
+    return m_scale;
+}
+
+void HistogramSource::setScale(Scale newScale)
+{
+    if (newScale == m_scale) {
+        return;
+    }
+
+    m_scale = newScale;
+    Q_EMIT scaleChanged();
+}
+
+qreal HistogramSource::binStart(int index) const
+{
+    const auto start = m_start + index * m_width;
+    return m_scale == Logarithmic ? std::pow(10.0, start) : start;
+}
+
+qreal HistogramSource::binEnd(int index) const
+{
+    return binStart(index + 1);
+}
+
+int HistogramSource::itemCount() const
+{
+    return m_bins.size();
+}
+
+QVariant HistogramSource::item(int index) const
+{
+    if (index < 0 || index >= int(m_bins.size())) {
+        return QVariant{};
+    }
+
+    return m_bins[index];
+}
+
+QVariant HistogramSource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_bins.cbegin(), m_bins.cend());
+        if (itr != m_bins.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant HistogramSource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_bins.cbegin(), m_bins.cend());
+        if (itr != m_bins.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void HistogramSource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_bins.size()));
+    if (first < last) {
+        std::copy(m_bins.cbegin() + first, m_bins.cbegin() + last, output + (first - start));
+    }
+}
+
+void HistogramSource::update()
+{
+    m_sourceCount = m_source ? m_source->itemCount() : 0;
+
+    std::vector<qreal> values(m_sourceCount);
+    if (m_sourceCount > 0) {
+        m_source->readValues(0, m_sourceCount, values.data());
+    }
+
+    if (updateRange(values)) {
+        addToBins(values);
+    }
+
+    Q_EMIT dataChanged();
+}
+
+void HistogramSource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+
+    const auto appended = !change.isReset() && change.itemCountChanged && change.start == m_sourceCount && count > m_sourceCount;
+    if (!appended || m_bins.empty()) {
+        update();
+        return;
+    }
+
+    std::vector<qreal> values(count - m_sourceCount);
+    m_source->readValues(m_sourceCount, int(values.size()), values.data());
+
+    // Items outside of an automatic range change the range, so all bins
+    // need to be calculated again.
+    if (m_automatic) {
+        const auto outside = std::any_of(values.cbegin(), values.cend(), [this](qreal value) {
+            const auto p = position(value);
+            return std::isfinite(p) && (p < m_start || p > m_end);
+        });
+        if (outside) {
+            update();
+            return;
+        }
+    }
+
+    m_sourceCount = count;
+    const auto [first, last] = addToBins(values);
+    if (first <= last) {
+        Q_EMIT itemsChanged(first, last - first + 1);
+    }
+    Q_EMIT dataChanged();
+}
+
+bool HistogramSource::updateRange(const std::vector<qreal> &values)
+{
+    m_bins.clear();
+
+    if (m_automatic) {
+        const auto chunks = chunkCount(values.size());
+        std::vector<std::pair<qreal, qreal>> ranges(chunks, {std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::lowest()});
+        forEachChunk(values.size(), chunks, [this, &values, &ranges](int chunk, std::size_t begin, std::size_t end) {
+            auto &range = ranges[chunk];
+            for (auto i = begin; i < end; ++i) {
+                const auto p = position(values[i]);
+                if (std::isfinite(p)) {
+                    range.first = std::min(range.first, p);
+                    range.second = std::max(range.second, p);
+                }
+            }
+        });
+
+        m_start = std::numeric_limits<qreal>::max();
+        m_end = std::numeric_limits<qreal>::lowest();
+        for (const auto &range : ranges) {
+            m_start = std::min(m_start, range.first);
+            m_end = std::max(m_end, range.second);
+        }
+
+        // All items having the same value still results in a valid range.
+        if (m_start == m_end) {
+            m_end = m_start + 1.0;
+        }
+    } else {
+        m_start = position(m_from);
+        m_end = position(m_to);
+    }
+
+    if (!std::isfinite(m_start) || !std::isfinite(m_end) || m_end <= m_start) {
+        m_start = 0.0;
+        m_end = 0.0;
+        m_width = 1.0;
+        return false;
+    }
+
+    auto binCount = m_binCount;
+    if (m_binWidth > 0.0) {
+        binCount = int(std::clamp(std::ceil((m_end - m_start) / m_binWidth), 1.0, qreal(maximumBinCount)));
+        m_width = m_binWidth;
+    } else {
+        m_width = (m_end - m_start) / binCount;
+    }
+
+    m_bins.assign(binCount, 0.0);
+    return true;
+}
+
+std::pair<int, int> HistogramSource::addToBins(const std::vector<qreal> &values)
+{
+    const auto chunks = chunkCount(values.size());
+    const auto binCount = m_bins.size();
+
+    // Each chunk counts into its own bins, which are combined afterwards.
+    std::vector<std::vector<quint64>> chunkBins(chunks);
+    forEachChunk(values.size(), chunks, [this, &values, &chunkBins, binCount](int chunk, std::size_t begin, std::size_t end) {
+        auto &bins = chunkBins[chunk];
+        bins.assign(binCount, 0);
+        for (auto i = begin; i < end; ++i) {
+            const auto index = binIndex(values[i]);
+            if (index >= 0) {
+                bins[index]++;
+            }
+        }
+    });
+
+    auto first = std::numeric_limits<int>::max();
+    auto last = -1;
+    for (const auto &bins : chunkBins) {
+        for (std::size_t i = 0; i < binCount; ++i) {
+            if (bins[i] > 0) {
+                m_bins[i] += bins[i];
+                first = std::min(first, int(i));
+                last = std::max(last, int(i));
+            }
+        }
+    }
+
+    return {first, last};
+}
+
+int HistogramSource::binIndex(qreal value) const
+{
+    const auto p = position(value);
+    if (!std::isfinite(p) || p < m_start || p > m_end) {
+        return -1;
+    }
+
+    // The end of the range is part of the last bin.
+    return std::min(int((p - m_start) / m_width), int(m_bins.size()) - 1);
+}
+
+qreal HistogramSource::position(qreal value) const
+{
+    if (m_scale == Logarithmic) {
+        return value > 0.0 ? std::log10(value) : std::numeric_limits<qreal>::quiet_NaN();
+    }
+    return value;
+}
+
+#include "moc_HistogramSource.cpp"
@@ -0,0 +1,159 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef HISTOGRAMSOURCE_H
+#define HISTOGRAMSOURCE_H
+
+#include <vector>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that counts how many items of a different data source fall
+ * into each of a number of bins.
+ *
+ * This provides one item per bin, containing the number of items of the
+ * source within that bin, which can be shown directly using a BarChart. Bins
+ * cover the range between \ref from and \ref to, or between the smallest and
+ * largest item of the source if \ref automatic is set. Items outside of the
+ * range are not counted.
+ *
+ * Sources with many items are binned in parallel, in chunks using the global
+ * thread pool. When items are appended to the source, only those are added
+ * to the bins, unless they extend an automatic range.
+ */
+class QUICKCHARTS_EXPORT HistogramSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * How the range is divided into bins.
+     */
+    enum Scale {
+        Linear, ///< All bins have the same width.
+        /**
+         * All bins have the same width on a logarithmic scale. Items that are
+         * zero or negative are not counted.
+         */
+        Logarithmic,
+    };
+    Q_ENUM(Scale)
+
+    explicit HistogramSource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The number of bins.
+     *
+     * Ignored if \ref binWidth is set. Defaults to 10.
+     */
+    Q_PROPERTY(int binCount READ binCount WRITE setBinCount NOTIFY binCountChanged)
+    int binCount() const;
+    void setBinCount(int newBinCount);
+    Q_SIGNAL void binCountChanged();
+
+    /**
+     * The width of each bin.
+     *
+     * If this is larger than 0, it determines the number of bins instead of
+     * \ref binCount. For a Logarithmic scale this is the width as a power of
+     * ten, so 1 means one bin per decade. Defaults to 0.
+     */
+    Q_PROPERTY(qreal binWidth READ binWidth WRITE setBinWidth NOTIFY binWidthChanged)
+    qreal binWidth() const;
+    void setBinWidth(qreal newBinWidth);
+    Q_SIGNAL void binWidthChanged();
+
+    /**
+     * The start of the range covered by the bins.
+     *
+     * Ignored if \ref automatic is true. Defaults to 0.
+     */
+    Q_PROPERTY(qreal from READ from WRITE setFrom NOTIFY fromChanged)
+    qreal from() const;
+    void setFrom(qreal newFrom);
+    Q_SIGNAL void fromChanged();
+
+    /**
+     * The end of the range covered by the bins.
+     *
+     * Ignored if \ref automatic is true. Defaults to 100.
+     */
+    Q_PROPERTY(qreal to READ to WRITE setTo NOTIFY toChanged)
+    qreal to() const;
+    void setTo(qreal newTo);
+    Q_SIGNAL void toChanged();
+
+    /**
+     * Whether to use the smallest and largest item of the source as range.
+     *
+     * Defaults to true.
+     */
+    Q_PROPERTY(bool automatic READ automatic WRITE setAutomatic NOTIFY automaticChanged)
+    bool automatic() const;
+    void setAutomatic(bool newAutomatic);
+    Q_SIGNAL void automaticChanged();
+
+    /**
+     * How the range is divided into bins.
+     *
+     * Defaults to Linear.
+     */
+    Q_PROPERTY(Scale scale READ scale WRITE setScale NOTIFY scaleChanged)
+    Scale scale() const;
+    void setScale(Scale newScale);
+    Q_SIGNAL void scaleChanged();
+
+    /**
+     * The value where bin \p index starts.
+     */
+    Q_INVOKABLE qreal binStart(int index) const;
+    /**
+     * The value where bin \p index ends.
+     */
+    Q_INVOKABLE qreal binEnd(int index) const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void update();
+    void onSourceDataChanged();
+    bool updateRange(const std::vector<qreal> &values);
+    std::pair<int, int> addToBins(const std::vector<qreal> &values);
+    int binIndex(qreal value) const;
+    qreal position(qreal value) const;
+
+    ChartDataSource *m_source = nullptr;
+    int m_binCount = 10;
+    qreal m_binWidth = 0.0;
+    qreal m_from = 0.0;
+    qreal m_to = 100.0;
+    bool m_automatic = true;
+    Scale m_scale = Linear;
+
+    int m_sourceCount = 0;
+    // The range and bin width in use, as logarithms for a Logarithmic scale.
+    qreal m_start = 0.0;
+    qreal m_end = 0.0;
+    qreal m_width = 1.0;
+    std::vector<qreal> m_bins;
+};
+
+#endif // HISTOGRAMSOURCE_H
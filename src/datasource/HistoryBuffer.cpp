@@ -0,0 +1,196 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "HistoryBuffer.h"
+
+#include <algorithm>
+
+HistoryBuffer::HistoryBuffer(int capacity)
+    : m_values(std::max(capacity, 0))
+{
+}
+
+int HistoryBuffer::capacity() const
+{
+    if (m_compressed) {
+        return m_compressed->capacity();
+    }
+
+    return int(m_values.size());
+}
+
+void HistoryBuffer::setCapacity(int capacity)
+{
+    if (m_compressed) {
+        m_compressed->setCapacity(capacity);
+        return;
+    }
+
+    capacity = std::max(capacity, 0);
+    if (capacity == int(m_values.size())) {
+        return;
+    }
+
+    // Copy the values we keep to their position in the new ring.
+    const auto newSize = std::min(m_size, capacity);
+    std::vector<double> values(capacity);
+    for (int i = 0; i < newSize; ++i) {
+        const auto sequence = m_sequence - 1 - i;
+        values[sequence % capacity] = at(i);
+    }
+
+    m_values = std::move(values);
+    m_size = newSize;
+    dropExpired();
+}
+
+bool HistoryBuffer::isCompressed() const
+{
+    return bool(m_compressed);
+}
+
+void HistoryBuffer::setCompressed(bool compressed)
+{
+    if (compressed == isCompressed()) {
+        return;
+    }
+
+    const auto currentCapacity = capacity();
+    std::vector<double> values(size());
+    read(0, int(values.size()), values.data());
+
+    if (compressed) {
+        m_compressed = std::make_unique<CompressedHistoryBuffer>(currentCapacity);
+        m_values = std::vector<double>{};
+    } else {
+        m_compressed.reset();
+        m_values.resize(currentCapacity);
+    }
+    clear();
+
+    // Values were read newest first, so push them in reverse.
+    std::for_each(values.crbegin(), values.crend(), [this](double value) {
+        push(value);
+    });
+}
+
+int HistoryBuffer::size() const
+{
+    if (m_compressed) {
+        return m_compressed->size();
+    }
+
+    return m_size;
+}
+
+bool HistoryBuffer::isEmpty() const
+{
+    return size() == 0;
+}
+
+void HistoryBuffer::push(double value)
+{
+    if (m_compressed) {
+        m_compressed->push(value);
+        return;
+    }
+
+    if (m_values.empty()) {
+        return;
+    }
+
+    const auto sequence = m_sequence++;
+    m_values[sequence % m_values.size()] = value;
+    m_size = std::min(m_size + 1, int(m_values.size()));
+
+    // Entries that can never become the minimum or maximum again since a
+    // newer value is smaller or larger are removed, which keeps both queues
+    // sorted with the current minimum and maximum at the front.
+    while (!m_minimum.empty() && m_minimum.back().value >= value) {
+        m_minimum.pop_back();
+    }
+    m_minimum.push_back(Entry{sequence, value});
+
+    while (!m_maximum.empty() && m_maximum.back().value <= value) {
+        m_maximum.pop_back();
+    }
+    m_maximum.push_back(Entry{sequence, value});
+
+    dropExpired();
+}
+
+void HistoryBuffer::clear()
+{
+    if (m_compressed) {
+        m_compressed->clear();
+    }
+
+    m_size = 0;
+    m_minimum.clear();
+    m_maximum.clear();
+}
+
+double HistoryBuffer::at(int index) const
+{
+    if (m_compressed) {
+        return m_compressed->at(index);
+    }
+
+    Q_ASSERT(index >= 0 && index < m_size);
+    return m_values[(m_sequence - 1 - index) % m_values.size()];
+}
+
+void HistoryBuffer::read(int start, int count, qreal *output) const
+{
+    if (m_compressed) {
+        m_compressed->read(start, count, output);
+        return;
+    }
+
+    Q_ASSERT(start >= 0 && start + count <= m_size);
+    if (count <= 0) {
+        return;
+    }
+
+    // Values are stored oldest to newest, so read backwards, wrapping around
+    // the start of the ring at most once.
+    const auto capacity = m_values.size();
+    auto position = (m_sequence - 1 - start) % capacity;
+    for (int i = 0; i < count; ++i) {
+        output[i] = m_values[position];
+        position = position == 0 ? capacity - 1 : position - 1;
+    }
+}
+
+double HistoryBuffer::minimum() const
+{
+    if (m_compressed) {
+        return m_compressed->minimum();
+    }
+
+    return m_minimum.empty() ? 0.0 : m_minimum.front().value;
+}
+
+double HistoryBuffer::maximum() const
+{
+    if (m_compressed) {
+        return m_compressed->maximum();
+    }
+
+    return m_maximum.empty() ? 0.0 : m_maximum.front().value;
+}
+
+void HistoryBuffer::dropExpired()
+{
+    const auto oldest = m_sequence - m_size;
+    while (!m_minimum.empty() && m_minimum.front().sequence < oldest) {
+        m_minimum.pop_front();
+    }
+    while (!m_maximum.empty() && m_maximum.front().sequence < oldest) {
+        m_maximum.pop_front();
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef HISTORYBUFFER_H
+#define HISTORYBUFFER_H
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <QtGlobal>
+
+#include "CompressedHistoryBuffer.h"
+
+/**
+ * A fixed-capacity buffer of values that tracks its minimum and maximum.
+ *
+ * New values are pushed at the front, so at(0) is always the most recent
+ * value. Once the buffer is full, pushing a value drops the oldest one. Both
+ * pushing and dropping values are O(1), as the values are stored in a ring
+ * buffer.
+ *
+ * The minimum and maximum are tracked using monotonic queues, which makes
+ * querying them O(1) and keeps pushing O(1) amortised.
+ *
+ * Alternatively, values can be stored compressed using a
+ * CompressedHistoryBuffer, which uses much less memory for large buffers but
+ * makes reading values and querying the minimum and maximum slower.
+ */
+class HistoryBuffer
+{
+public:
+    explicit HistoryBuffer(int capacity = 0);
+
+    /**
+     * The maximum number of values stored.
+     *
+     * Reducing the capacity drops the oldest values.
+     */
+    int capacity() const;
+    void setCapacity(int capacity);
+
+    /**
+     * Whether values are stored compressed.
+     *
+     * Changing this keeps the existing values.
+     */
+    bool isCompressed() const;
+    void setCompressed(bool compressed);
+
+    int size() const;
+    bool isEmpty() const;
+
+    /**
+     * Add a value at the front, dropping the oldest value if full.
+     */
+    void push(double value);
+    /**
+     * Remove all values.
+     */
+    void clear();
+
+    /**
+     * The value at \p index, where 0 is the most recent value.
+     *
+     * \p index must be a valid index.
+     */
+    double at(int index) const;
+    /**
+     * Copy \p count values, starting at \p start, to \p output.
+     *
+     * The range must be within the buffer.
+     */
+    void read(int start, int count, qreal *output) const;
+
+    /**
+     * The smallest value in the buffer, or 0 if it is empty.
+     */
+    double minimum() const;
+    /**
+     * The largest value in the buffer, or 0 if it is empty.
+     */
+    double maximum() const;
+
+private:
+    struct Entry {
+        quint64 sequence;
+        double value;
+    };
+
+    void dropExpired();
+
+    std::vector<double> m_values;
+    int m_size = 0;
+    // The sequence number of the next value pushed. The value with sequence
+    // number n is stored at n % capacity.
+    quint64 m_sequence = 0;
+    std::deque<Entry> m_minimum;
+    std::deque<Entry> m_maximum;
+
+    // Used instead of the above if compressed.
+    std::unique_ptr<CompressedHistoryBuffer> m_compressed;
+};
+
+#endif // HISTORYBUFFER_H
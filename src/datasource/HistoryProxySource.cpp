@@ -8,10 +8,74 @@
 #include "HistoryProxySource.h"
 
 #include <QDebug>
+#include <QFile>
+#include <QMutex>
+#include <QSaveFile>
+#include <QThreadPool>
+#include <QtEndian>
+
+#include "charts_datasource_logging.h"
+
+// Snapshot files start with a header of four 32-bit values: the magic "KQHS",
+// the version, the type of the values and the number of values. This is
+// followed by the values of the history as little-endian doubles, oldest
+// first.
+static constexpr qsizetype SnapshotHeaderSize = 16;
+static constexpr quint32 SnapshotVersion = 1;
+
+// Shared with the threads writing snapshots, so snapshots are written one at
+// a time and an older snapshot never replaces a newer one.
+struct HistoryProxySource::SnapshotWriter {
+    QMutex mutex;
+    quint64 written = 0;
+
+    void write(quint64 generation, const QString &fileName, quint32 valueType, const std::vector<double> &values);
+};
+
+void HistoryProxySource::SnapshotWriter::write(quint64 generation, const QString &fileName, quint32 valueType, const std::vector<double> &values)
+{
+    QMutexLocker locker(&mutex);
+    if (generation <= written) {
+        return;
+    }
+
+    QByteArray data(SnapshotHeaderSize + qsizetype(values.size() * sizeof(double)), Qt::Uninitialized);
+    std::copy_n("KQHS", 4, data.data());
+    qToLittleEndian<quint32>(SnapshotVersion, data.data() + 4);
+    qToLittleEndian<quint32>(valueType, data.data() + 8);
+    qToLittleEndian<quint32>(quint32(values.size()), data.data() + 12);
+    qToLittleEndian<double>(values.data(), qsizetype(values.size()), data.data() + SnapshotHeaderSize);
+
+    // Write to a temporary file first, so a crash while writing does not
+    // leave behind a broken snapshot.
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        qCWarning(DATASOURCE) << "HistoryProxySource: Could not write snapshot" << fileName << file.errorString();
+        return;
+    }
+
+    written = generation;
+}
 
 HistoryProxySource::HistoryProxySource(QObject *parent)
     : ChartDataSource(parent)
+    , m_history(m_maximumHistory)
+    , m_snapshotWriter(std::make_shared<SnapshotWriter>())
 {
+    connect(&m_snapshotTimer, &QTimer::timeout, this, [this]() {
+        if (revision() != m_snapshotRevision) {
+            saveSnapshot();
+        }
+    });
+}
+
+HistoryProxySource::~HistoryProxySource()
+{
+    // If the snapshot was not loaded yet, saving would replace it with an
+    // incomplete history.
+    if (!m_loadQueued && revision() != m_snapshotRevision) {
+        saveSnapshot();
+    }
 }
 
 int HistoryProxySource::itemCount() const
@@ -29,48 +93,78 @@ QVariant HistoryProxySource::item(int index) const
         return QVariant{};
     }
 
-    if (m_fillMode == DoNotFill && index >= m_history.count()) {
+    if (m_fillMode == DoNotFill && index >= m_history.size()) {
         return QVariant{};
     }
 
-    if (m_fillMode == FillFromStart && index >= m_history.count()) {
+    if (m_fillMode == FillFromStart && index >= m_history.size()) {
         return QVariant{QMetaType(m_dataSource->item(0).userType())};
     }
 
-    if (m_fillMode == FillFromEnd && m_history.count() != m_maximumHistory) {
-        auto actualIndex = index - (m_maximumHistory - m_history.count());
+    if (m_fillMode == FillFromEnd && m_history.size() != m_maximumHistory) {
+        auto actualIndex = index - (m_maximumHistory - m_history.size());
         if (actualIndex < 0 || actualIndex >= m_history.size()) {
             return QVariant{QMetaType(m_dataSource->item(0).userType())};
         } else {
-            return m_history.at(actualIndex);
+            return historyItem(actualIndex);
         }
     }
 
-    if (index < m_history.count()) {
-        return m_history.at(index);
+    if (index < m_history.size()) {
+        return historyItem(index);
     } else {
         return QVariant{};
     }
 }
 
+void HistoryProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    if (!m_dataSource || m_dataSource->itemCount() == 0) {
+        return;
+    }
+
+    // Items that are not part of the history are either invalid or a
+    // default-constructed value, both of which are 0 as a number.
+    auto offset = 0;
+    if (m_fillMode == FillFromEnd && m_history.size() != m_maximumHistory) {
+        offset = m_maximumHistory - m_history.size();
+    }
+
+    const auto first = std::max(start, offset);
+    const auto last = std::min(start + count, offset + m_history.size());
+    if (first < last) {
+        m_history.read(first - offset, last - first, output + (first - start));
+    }
+}
+
 QVariant HistoryProxySource::minimum() const
 {
     if (m_history.isEmpty() || !m_dataSource) {
         return QVariant{};
     }
 
-    // TODO: Find a nicer solution for data sources to indicate
-    // "I provide a min/max value not derived from my items"
-    auto model = m_dataSource->property("model").value<QObject *>();
-    if (model) {
-        auto minProperty = model->property("minimum");
-        auto maxProperty = model->property("maximum");
-        if (minProperty.isValid() && minProperty != maxProperty) {
-            return minProperty;
+    // The history only changes when dataChanged is emitted, so the model
+    // lookup below only needs to be done once per change.
+    return cachedMinimum([this]() {
+        // TODO: Find a nicer solution for data sources to indicate
+        // "I provide a min/max value not derived from my items"
+        auto model = m_dataSource->property("model").value<QObject *>();
+        if (model) {
+            auto minProperty = model->property("minimum");
+            auto maxProperty = model->property("maximum");
+            if (minProperty.isValid() && minProperty != maxProperty) {
+                return minProperty;
+            }
         }
-    }
 
-    return *std::min_element(m_history.begin(), m_history.end(), variantCompare);
+        if (m_hasVariantHistory) {
+            return *std::min_element(m_variantHistory.cbegin(), m_variantHistory.cend(), variantCompare);
+        }
+
+        return toVariant(m_history.minimum());
+    });
 }
 
 QVariant HistoryProxySource::maximum() const
@@ -79,22 +173,28 @@ QVariant HistoryProxySource::maximum() const
         return QVariant{};
     }
 
-    auto model = m_dataSource->property("model").value<QObject *>();
-    if (model) {
-        auto minProperty = model->property("minimum");
-        auto maxProperty = model->property("maximum");
-        if (maxProperty.isValid() && maxProperty != minProperty) {
-            return maxProperty;
+    return cachedMaximum([this]() {
+        auto model = m_dataSource->property("model").value<QObject *>();
+        if (model) {
+            auto minProperty = model->property("minimum");
+            auto maxProperty = model->property("maximum");
+            if (maxProperty.isValid() && maxProperty != minProperty) {
+                return maxProperty;
+            }
+        }
+
+        if (m_hasVariantHistory) {
+            return *std::max_element(m_variantHistory.cbegin(), m_variantHistory.cend(), variantCompare);
         }
-    }
 
-    return *std::max_element(m_history.begin(), m_history.end(), variantCompare);
+        return toVariant(m_history.maximum());
+    });
 }
 
 QVariant HistoryProxySource::first() const
 {
     if (!m_history.isEmpty()) {
-        return m_history.first();
+        return historyItem(0);
     }
     return QVariant{};
 }
@@ -154,8 +254,14 @@ void HistoryProxySource::setMaximumHistory(int newMaximumHistory)
     }
 
     m_maximumHistory = newMaximumHistory;
-    while (m_history.size() > 0 && m_history.size() > m_maximumHistory) {
-        m_history.removeLast();
+
+    const auto previousSize = m_history.size();
+    m_history.setCapacity(m_maximumHistory);
+    if (m_hasVariantHistory) {
+        m_variantHistory.resize(m_history.size());
+    }
+    if (m_history.size() != previousSize) {
+        Q_EMIT dataChanged();
     }
 
     Q_EMIT maximumHistoryChanged();
@@ -206,9 +312,91 @@ void HistoryProxySource::setFillMode(FillMode newFillMode)
     Q_EMIT fillModeChanged();
 }
 
+bool HistoryProxySource::compressed() const
+{
+    return m_history.isCompressed();
+}
+
+void HistoryProxySource::setCompressed(bool newCompressed)
+{
+    if (newCompressed == m_history.isCompressed()) {
+        return;
+    }
+
+    m_history.setCompressed(newCompressed);
+    Q_EMIT compressedChanged();
+}
+
+QString HistoryProxySource::snapshotFile() const
+{
+    return m_snapshotFile;
+}
+
+void HistoryProxySource::setSnapshotFile(const QString &newSnapshotFile)
+{
+    if (newSnapshotFile == m_snapshotFile) {
+        return;
+    }
+
+    m_snapshotFile = newSnapshotFile;
+    queueLoadSnapshot();
+    updateSnapshotTimer();
+    Q_EMIT snapshotFileChanged();
+}
+
+int HistoryProxySource::snapshotInterval() const
+{
+    return m_snapshotInterval;
+}
+
+void HistoryProxySource::setSnapshotInterval(int newSnapshotInterval)
+{
+    if (newSnapshotInterval == m_snapshotInterval) {
+        return;
+    }
+
+    m_snapshotInterval = newSnapshotInterval;
+    updateSnapshotTimer();
+    Q_EMIT snapshotIntervalChanged();
+}
+
+void HistoryProxySource::saveSnapshot()
+{
+    if (m_snapshotFile.isEmpty()) {
+        return;
+    }
+
+    if (m_loadQueued) {
+        loadSnapshot();
+    }
+
+    if (m_hasVariantHistory) {
+        qCWarning(DATASOURCE) << "HistoryProxySource: Not saving snapshot" << m_snapshotFile << "as the history contains items that are not numbers";
+        m_snapshotRevision = revision();
+        return;
+    }
+
+    // Only copying the values happens here, everything else is done by the
+    // writing thread.
+    std::vector<double> values(m_history.size());
+    m_history.read(0, int(values.size()), values.data());
+    std::reverse(values.begin(), values.end());
+
+    // Only built-in types have a type ID that is the same for every run.
+    const auto valueType = m_valueType.isValid() && m_valueType.id() < QMetaType::User ? quint32(m_valueType.id()) : 0;
+
+    m_snapshotRevision = revision();
+    QThreadPool::globalInstance()->start(
+        [writer = m_snapshotWriter, generation = ++m_snapshotGeneration, fileName = m_snapshotFile, valueType, values = std::move(values)]() {
+            writer->write(generation, fileName, valueType, values);
+        });
+}
+
 void HistoryProxySource::clear()
 {
     m_history.clear();
+    m_variantHistory.clear();
+    m_hasVariantHistory = false;
     Q_EMIT dataChanged();
 }
 
@@ -218,12 +406,156 @@ void HistoryProxySource::update()
         return;
     }
 
-    m_history.prepend(m_dataSource->item(m_item));
-    while (m_history.size() > 0 && m_history.size() > m_maximumHistory) {
-        m_history.removeLast();
+    const auto previousSize = m_history.size();
+
+    const auto value = m_dataSource->item(m_item);
+
+    // Items that are not numbers would be lost when stored as one, so from
+    // then on the items themselves are stored as well.
+    bool ok = false;
+    const auto number = value.toDouble(&ok);
+    if (!ok && value.isValid() && !m_hasVariantHistory) {
+        startVariantHistory();
+    }
+
+    if (value.isValid()) {
+        m_valueType = value.metaType();
+    }
+
+    m_history.push(number);
+    if (m_hasVariantHistory) {
+        m_variantHistory.push_front(value);
+        m_variantHistory.resize(m_history.size());
+    }
+
+    if (m_fillMode == FillFromEnd && previousSize < m_maximumHistory) {
+        // Partial history is placed at the end, so the new item takes the
+        // place of an empty item in front of the existing history.
+        Q_EMIT itemsChanged(m_maximumHistory - previousSize - 1, 1);
+    } else if (m_maximumHistory > 0) {
+        // Otherwise everything moves one place towards the end, with the last
+        // item dropping off once the history is full.
+        Q_EMIT itemsInserted(0, 1);
+        if (previousSize == m_history.size() || m_fillMode != DoNotFill) {
+            Q_EMIT itemsRemoved(itemCount(), 1);
+        }
     }
 
     Q_EMIT dataChanged();
 }
 
+void HistoryProxySource::queueLoadSnapshot()
+{
+    // Delay loading until all properties are set, as changing some of them
+    // clears the history.
+    if (!m_loadQueued) {
+        m_loadQueued = true;
+        QMetaObject::invokeMethod(this, &HistoryProxySource::loadSnapshot, Qt::QueuedConnection);
+    }
+}
+
+void HistoryProxySource::loadSnapshot()
+{
+    if (!m_loadQueued) {
+        return;
+    }
+
+    m_loadQueued = false;
+
+    if (m_snapshotFile.isEmpty() || !QFile::exists(m_snapshotFile)) {
+        return;
+    }
+
+    QFile file(m_snapshotFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(DATASOURCE) << "HistoryProxySource: Could not read snapshot" << m_snapshotFile << file.errorString();
+        return;
+    }
+
+    const auto data = file.readAll();
+    if (data.size() < SnapshotHeaderSize || !data.startsWith("KQHS") || qFromLittleEndian<quint32>(data.constData() + 4) != SnapshotVersion) {
+        qCWarning(DATASOURCE) << "HistoryProxySource: Ignoring invalid snapshot" << m_snapshotFile;
+        return;
+    }
+
+    const auto valueType = qFromLittleEndian<quint32>(data.constData() + 8);
+    const auto count = qsizetype(qFromLittleEndian<quint32>(data.constData() + 12));
+    if (data.size() != SnapshotHeaderSize + count * qsizetype(sizeof(double))) {
+        qCWarning(DATASOURCE) << "HistoryProxySource: Ignoring invalid snapshot" << m_snapshotFile;
+        return;
+    }
+
+    std::vector<double> values(count);
+    qFromLittleEndian<double>(data.constData() + SnapshotHeaderSize, count, values.data());
+
+    // Anything recorded so far is newer than the snapshot, so goes after it.
+    std::vector<double> recorded(m_history.size());
+    m_history.read(0, int(recorded.size()), recorded.data());
+
+    m_history.clear();
+    for (auto value : values) {
+        m_history.push(value);
+    }
+    std::for_each(recorded.crbegin(), recorded.crend(), [this](double value) {
+        m_history.push(value);
+    });
+
+    // The snapshot only contains numbers, which go after the recorded items.
+    if (m_hasVariantHistory) {
+        for (auto index = int(m_variantHistory.size()); index < m_history.size(); ++index) {
+            m_variantHistory.push_back(toVariant(m_history.at(index)));
+        }
+        m_variantHistory.resize(m_history.size());
+    }
+
+    if (!m_valueType.isValid() && valueType != 0) {
+        m_valueType = QMetaType(int(valueType));
+    }
+
+    Q_EMIT dataChanged();
+
+    // No need to save what was just loaded.
+    if (recorded.empty()) {
+        m_snapshotRevision = revision();
+    }
+}
+
+void HistoryProxySource::updateSnapshotTimer()
+{
+    if (!m_snapshotFile.isEmpty() && m_snapshotInterval > 0) {
+        m_snapshotTimer.start(m_snapshotInterval);
+    } else {
+        m_snapshotTimer.stop();
+    }
+}
+
+QVariant HistoryProxySource::toVariant(double value) const
+{
+    // History is stored as numbers, but return values using the type provided
+    // by the source so they compare equal to the source's values.
+    QVariant result{value};
+    if (m_valueType.isValid() && m_valueType != result.metaType()) {
+        result.convert(m_valueType);
+    }
+    return result;
+}
+
+QVariant HistoryProxySource::historyItem(int index) const
+{
+    if (m_hasVariantHistory) {
+        return m_variantHistory.at(index);
+    }
+    return toVariant(m_history.at(index));
+}
+
+void HistoryProxySource::startVariantHistory()
+{
+    // Keep what was recorded so far, which were all numbers.
+    m_variantHistory.clear();
+    for (int i = 0; i < m_history.size(); ++i) {
+        m_variantHistory.push_back(toVariant(m_history.at(i)));
+    }
+    m_hasVariantHistory = true;
+}
+
 #include "moc_HistoryProxySource.cpp"
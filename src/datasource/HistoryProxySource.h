@@ -8,18 +8,31 @@
 #ifndef HISTORYPROXYSOURCE_H
 #define HISTORYPROXYSOURCE_H
 
-#include <QList>
 #include <QTimer>
 #include <QVariant>
+#include <deque>
 #include <memory>
 
 #include "ChartDataSource.h"
+#include "HistoryBuffer.h"
 
 /**
  * A data source that provides a history of a single item of a different data source.
  *
  * This data source will monitor a single item of another data source for changes
  * and record them, exposing historical values as
+ *
+ * History is stored as numbers in a fixed-size ring buffer, so recording a
+ * value as well as querying minimum and maximum are constant time operations.
+ * This only works for items that can be converted to a number. Once the source
+ * provides an item that cannot, like a string describing a state, the history
+ * is stored as variants instead. This keeps the items intact, but recording
+ * and finding the minimum and maximum become linear time operations, and the
+ * history cannot be saved to a snapshot anymore.
+ *
+ * To avoid starting with an empty history every time an application starts,
+ * the history can be saved to \ref snapshotFile, from which it is restored
+ * when the source is created again.
  */
 class QUICKCHARTS_EXPORT HistoryProxySource : public ChartDataSource
 {
@@ -58,6 +71,7 @@ public:
     Q_ENUM(FillMode)
 
     explicit HistoryProxySource(QObject *parent = nullptr);
+    ~HistoryProxySource() override;
 
     /**
      * The data source to read data from.
@@ -122,6 +136,59 @@ public:
     FillMode fillMode() const;
     void setFillMode(FillMode newFillMode);
     Q_SIGNAL void fillModeChanged();
+    /**
+     * Whether to store the history compressed.
+     *
+     * Compressed history typically uses one to three bytes per value rather
+     * than eight, which is intended for long histories, like a week of values
+     * sampled every second. Values are compressed in blocks of 1024, so
+     * reading items decompresses one block at a time. The values themselves
+     * are not affected.
+     *
+     * The default is false.
+     */
+    Q_PROPERTY(bool compressed READ compressed WRITE setCompressed NOTIFY compressedChanged)
+    bool compressed() const;
+    void setCompressed(bool newCompressed);
+    Q_SIGNAL void compressedChanged();
+    /**
+     * A file to save the history to, so it can be restored later.
+     *
+     * When set, the history is loaded from this file, if it exists, and added
+     * before any values recorded so far. The history is then saved every
+     * \ref snapshotInterval milliseconds and when the source is destroyed.
+     * Saving happens on a separate thread, so it never blocks.
+     *
+     * The file only contains the values of the history, it is up to the
+     * application to use a different file for every source.
+     *
+     * The default is empty, which means the history is not saved.
+     */
+    Q_PROPERTY(QString snapshotFile READ snapshotFile WRITE setSnapshotFile NOTIFY snapshotFileChanged)
+    QString snapshotFile() const;
+    void setSnapshotFile(const QString &newSnapshotFile);
+    Q_SIGNAL void snapshotFileChanged();
+    /**
+     * The interval, in milliseconds, with which to save the history to
+     * \ref snapshotFile.
+     *
+     * The history is only saved if it changed. If set to a value <= 0, the
+     * history is only saved when the source is destroyed or when
+     * saveSnapshot() is called.
+     *
+     * The default is 60000.
+     */
+    Q_PROPERTY(int snapshotInterval READ snapshotInterval WRITE setSnapshotInterval NOTIFY snapshotIntervalChanged)
+    int snapshotInterval() const;
+    void setSnapshotInterval(int newSnapshotInterval);
+    Q_SIGNAL void snapshotIntervalChanged();
+
+    /**
+     * Save the history to \ref snapshotFile.
+     *
+     * The file is written on a separate thread.
+     */
+    Q_INVOKABLE void saveSnapshot();
 
     /**
      * Clear the entire history of this source.
@@ -132,17 +199,40 @@ public:
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
     QVariant first() const override;
 
 private:
+    struct SnapshotWriter;
+
     void update();
+    QVariant toVariant(double value) const;
+    QVariant historyItem(int index) const;
+    void startVariantHistory();
+    void queueLoadSnapshot();
+    void loadSnapshot();
+    void updateSnapshotTimer();
 
     ChartDataSource *m_dataSource = nullptr;
     int m_item = 0;
     int m_maximumHistory = 10;
     FillMode m_fillMode = DoNotFill;
     std::unique_ptr<QTimer> m_updateTimer;
-    QList<QVariant> m_history;
+    HistoryBuffer m_history;
+    QMetaType m_valueType;
+    // The items themselves, most recent first, once an item was recorded that
+    // can not be converted to a number. The numbers in m_history are still
+    // kept, to read values from.
+    std::deque<QVariant> m_variantHistory;
+    bool m_hasVariantHistory = false;
+
+    QString m_snapshotFile;
+    int m_snapshotInterval = 60000;
+    QTimer m_snapshotTimer;
+    bool m_loadQueued = false;
+    quint64 m_snapshotRevision = 0;
+    quint64 m_snapshotGeneration = 0;
+    std::shared_ptr<SnapshotWriter> m_snapshotWriter;
 };
 
 #endif // HISTORYPROXYSOURCE_H
@@ -0,0 +1,169 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "HistorySource.h"
+
+HistorySource::HistorySource(QObject *parent)
+    : ChartDataSource(parent)
+    , m_history(m_maximumHistory)
+{
+}
+
+int HistorySource::maximumHistory() const
+{
+    return m_maximumHistory;
+}
+
+void HistorySource::setMaximumHistory(int newMaximumHistory)
+{
+    if (newMaximumHistory == m_maximumHistory) {
+        return;
+    }
+
+    m_maximumHistory = newMaximumHistory;
+    m_history.setCapacity(m_maximumHistory);
+    Q_EMIT dataChanged();
+    Q_EMIT maximumHistoryChanged();
+}
+
+HistoryProxySource::FillMode HistorySource::fillMode() const
+{
+    return m_fillMode;
+}
+
+void HistorySource::setFillMode(HistoryProxySource::FillMode newFillMode)
+{
+    if (newFillMode == m_fillMode) {
+        return;
+    }
+
+    m_fillMode = newFillMode;
+    Q_EMIT dataChanged();
+    Q_EMIT fillModeChanged();
+}
+
+bool HistorySource::compressed() const
+{
+    return m_history.isCompressed();
+}
+
+void HistorySource::setCompressed(bool newCompressed)
+{
+    if (newCompressed == m_history.isCompressed()) {
+        return;
+    }
+
+    m_history.setCompressed(newCompressed);
+    Q_EMIT compressedChanged();
+}
+
+void HistorySource::clear()
+{
+    m_history.clear();
+    Q_EMIT dataChanged();
+}
+
+int HistorySource::itemCount() const
+{
+    if (m_fillMode == HistoryProxySource::DoNotFill) {
+        return m_history.size();
+    } else {
+        return m_maximumHistory;
+    }
+}
+
+QVariant HistorySource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    const auto historyIndex = index - historyOffset();
+    if (historyIndex < 0 || historyIndex >= m_history.size()) {
+        return 0.0;
+    }
+
+    return m_history.at(historyIndex);
+}
+
+QVariant HistorySource::minimum() const
+{
+    if (m_history.isEmpty()) {
+        return QVariant{};
+    }
+
+    // Compressed history needs to go through its blocks to find the minimum.
+    return cachedMinimum([this]() {
+        return QVariant{m_history.minimum()};
+    });
+}
+
+QVariant HistorySource::maximum() const
+{
+    if (m_history.isEmpty()) {
+        return QVariant{};
+    }
+
+    return cachedMaximum([this]() {
+        return QVariant{m_history.maximum()};
+    });
+}
+
+void HistorySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto offset = historyOffset();
+    const auto first = std::max(start, offset);
+    const auto last = std::min(start + count, offset + m_history.size());
+    if (first < last) {
+        m_history.read(first - offset, last - first, output + (first - start));
+    }
+}
+
+void HistorySource::appendValues(const qreal *values, int count)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    const auto previousSize = m_history.size();
+    const auto previousCount = itemCount();
+
+    // Only the most recent values fit, so skip the rest.
+    const auto skip = std::max(count - m_maximumHistory, 0);
+    for (int i = skip; i < count; ++i) {
+        m_history.push(values[i]);
+    }
+
+    const auto added = count - skip;
+    if (m_fillMode == HistoryProxySource::FillFromEnd && previousSize + count <= m_maximumHistory) {
+        // Partial history is placed at the end, so new items take the place of
+        // empty items in front of the existing history.
+        Q_EMIT itemsChanged(m_maximumHistory - m_history.size(), added);
+    } else if (added > 0) {
+        // Otherwise everything moves towards the end, with items dropping off
+        // once the history is full.
+        Q_EMIT itemsInserted(0, added);
+        const auto removed = previousCount + added - itemCount();
+        if (removed > 0) {
+            Q_EMIT itemsRemoved(itemCount(), removed);
+        }
+    }
+
+    Q_EMIT dataChanged();
+}
+
+int HistorySource::historyOffset() const
+{
+    if (m_fillMode == HistoryProxySource::FillFromEnd) {
+        return std::max(m_maximumHistory - m_history.size(), 0);
+    }
+    return 0;
+}
+
+#include "moc_HistorySource.cpp"
@@ -0,0 +1,91 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef HISTORYSOURCE_H
+#define HISTORYSOURCE_H
+
+#include "ChartDataSource.h"
+#include "HistoryBuffer.h"
+#include "HistoryProxySource.h"
+
+/**
+ * Base class for data sources that keep a history of values they receive.
+ *
+ * Values are stored like \ref HistoryProxySource does, with the most recent
+ * value as item 0 and at most \ref maximumHistory values. Subclasses add
+ * values using appendValues().
+ */
+class QUICKCHARTS_EXPORT HistorySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Base Class")
+
+public:
+    explicit HistorySource(QObject *parent = nullptr);
+
+    /**
+     * The maximum number of values to keep.
+     *
+     * Defaults to 10, like \ref HistoryProxySource.
+     */
+    Q_PROPERTY(int maximumHistory READ maximumHistory WRITE setMaximumHistory NOTIFY maximumHistoryChanged)
+    int maximumHistory() const;
+    void setMaximumHistory(int newMaximumHistory);
+    Q_SIGNAL void maximumHistoryChanged();
+
+    /**
+     * How to fill items that have no value yet.
+     *
+     * Items without value are 0.
+     *
+     * \see HistoryProxySource::fillMode
+     */
+    Q_PROPERTY(HistoryProxySource::FillMode fillMode READ fillMode WRITE setFillMode NOTIFY fillModeChanged)
+    HistoryProxySource::FillMode fillMode() const;
+    void setFillMode(HistoryProxySource::FillMode newFillMode);
+    Q_SIGNAL void fillModeChanged();
+
+    /**
+     * Whether to store the history compressed.
+     *
+     * \see HistoryProxySource::compressed
+     */
+    Q_PROPERTY(bool compressed READ compressed WRITE setCompressed NOTIFY compressedChanged)
+    bool compressed() const;
+    void setCompressed(bool newCompressed);
+    Q_SIGNAL void compressedChanged();
+
+    /**
+     * Clear the values received so far.
+     */
+    Q_INVOKABLE void clear();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+protected:
+    /**
+     * Add \p count values, ordered from oldest to newest.
+     *
+     * This emits dataChanged() once, preceded by signals describing which
+     * items changed.
+     */
+    void appendValues(const qreal *values, int count);
+
+private:
+    int historyOffset() const;
+
+    int m_maximumHistory = 10;
+    HistoryProxySource::FillMode m_fillMode = HistoryProxySource::DoNotFill;
+    HistoryBuffer m_history;
+};
+
+#endif // HISTORYSOURCE_H
@@ -9,49 +9,49 @@
 MapProxySource::MapProxySource(QObject *parent)
     : ChartDataSource(parent)
 {
-    connect(this, &MapProxySource::sourceChanged, this, &ChartDataSource::dataChanged);
-    connect(this, &MapProxySource::mapChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &MapProxySource::sourceChanged, this, &MapProxySource::updateItems);
+    connect(this, &MapProxySource::mapChanged, this, &MapProxySource::updateMap);
 }
 
 int MapProxySource::itemCount() const
 {
-    if (m_source) {
-        return m_source->itemCount();
-    }
-
-    return 0;
+    return m_indices.size();
 }
 
 QVariant MapProxySource::minimum() const
 {
-    auto itr = std::min_element(m_map.cbegin(), m_map.cend(), variantCompare);
-    if (itr != m_map.cend()) {
-        return *itr;
-    }
-    return QVariant{};
+    return m_minimum;
 }
 
 QVariant MapProxySource::maximum() const
 {
-    auto itr = std::max_element(m_map.cbegin(), m_map.cend(), variantCompare);
-    if (itr != m_map.cend()) {
-        return *itr;
-    }
-    return QVariant{};
+    return m_maximum;
 }
 
 QVariant MapProxySource::item(int index) const
 {
-    if (!m_source) {
+    if (index < 0 || index >= int(m_indices.size())) {
         return QVariant{};
     }
 
-    auto mapIndex = m_source->item(index).toString();
-    if (mapIndex.isEmpty()) {
+    const auto valueIndex = m_indices[index];
+    if (valueIndex < 0) {
         return QVariant{};
     }
 
-    return m_map.value(mapIndex);
+    return m_values.at(valueIndex);
+}
+
+void MapProxySource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        if (index < 0 || index >= int(m_indices.size()) || m_indices[index] < 0) {
+            output[i] = 0.0;
+        } else {
+            output[i] = m_numbers[m_indices[index]];
+        }
+    }
 }
 
 ChartDataSource *MapProxySource::source() const
@@ -71,7 +71,14 @@ void MapProxySource::setSource(ChartDataSource *newSource)
 
     m_source = newSource;
     if (m_source) {
-        connect(m_source, &ChartDataSource::dataChanged, this, &ChartDataSource::dataChanged);
+        connect(m_source, &ChartDataSource::itemsChanged, this, &MapProxySource::onSourceItemsChanged);
+        connect(m_source, &ChartDataSource::itemsInserted, this, &MapProxySource::onSourceItemsInserted);
+        connect(m_source, &ChartDataSource::itemsRemoved, this, &MapProxySource::onSourceItemsRemoved);
+        connect(m_source, &ChartDataSource::dataChanged, this, &MapProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            updateItems();
+        });
     }
     Q_EMIT sourceChanged();
 }
@@ -92,4 +99,97 @@ void MapProxySource::setMap(const QVariantMap &newMap)
     Q_EMIT mapChanged();
 }
 
+void MapProxySource::updateMap()
+{
+    m_keys.clear();
+    m_values.clear();
+    m_numbers.clear();
+    m_minimum = QVariant{};
+    m_maximum = QVariant{};
+
+    m_keys.reserve(m_map.size());
+    m_values.reserve(m_map.size());
+    m_numbers.reserve(m_map.size());
+    for (auto itr = m_map.cbegin(); itr != m_map.cend(); ++itr) {
+        m_keys.insert(itr.key(), m_values.size());
+        m_values.append(itr.value());
+        m_numbers.push_back(itr.value().toDouble());
+    }
+
+    auto minimum = std::min_element(m_values.cbegin(), m_values.cend(), variantCompare);
+    if (minimum != m_values.cend()) {
+        m_minimum = *minimum;
+    }
+
+    auto maximum = std::max_element(m_values.cbegin(), m_values.cend(), variantCompare);
+    if (maximum != m_values.cend()) {
+        m_maximum = *maximum;
+    }
+
+    updateItems();
+}
+
+void MapProxySource::updateItems()
+{
+    m_indices.resize(m_source ? m_source->itemCount() : 0);
+    mapItems(0, m_indices.size());
+    Q_EMIT dataChanged();
+}
+
+void MapProxySource::mapItems(int start, int count)
+{
+    for (int i = start; i < start + count; ++i) {
+        const auto key = m_source->item(i).toString();
+        m_indices[i] = key.isEmpty() ? -1 : m_keys.value(key, -1);
+    }
+}
+
+void MapProxySource::onSourceItemsChanged(int start, int count)
+{
+    if (start < 0 || start + count > int(m_indices.size())) {
+        return;
+    }
+
+    m_sourceChangeKnown = true;
+    mapItems(start, count);
+    Q_EMIT itemsChanged(start, count);
+}
+
+void MapProxySource::onSourceItemsInserted(int start, int count)
+{
+    if (start < 0 || start > int(m_indices.size())) {
+        return;
+    }
+
+    m_sourceChangeKnown = true;
+    m_indices.insert(m_indices.begin() + start, count, -1);
+    mapItems(start, count);
+    Q_EMIT itemsInserted(start, count);
+}
+
+void MapProxySource::onSourceItemsRemoved(int start, int count)
+{
+    if (start < 0 || start + count > int(m_indices.size())) {
+        return;
+    }
+
+    m_sourceChangeKnown = true;
+    m_indices.erase(m_indices.begin() + start, m_indices.begin() + start + count);
+    Q_EMIT itemsRemoved(start, count);
+}
+
+void MapProxySource::onSourceDataChanged()
+{
+    // Without any information about which items changed, everything needs to
+    // be mapped again.
+    if (!m_sourceChangeKnown || int(m_indices.size()) != m_source->itemCount()) {
+        m_sourceChangeKnown = false;
+        updateItems();
+        return;
+    }
+
+    m_sourceChangeKnown = false;
+    Q_EMIT dataChanged();
+}
+
 #include "moc_MapProxySource.cpp"
@@ -8,6 +8,9 @@
 
 #include "ChartDataSource.h"
 
+#include <vector>
+
+#include <QHash>
 #include <QVariant>
 
 /**
@@ -17,6 +20,10 @@
  * a map of different values and returns the appropriate value from that map.
  * This source's itemCount matches that of the other source.
  *
+ * The mapped values are determined once when the source or map changes, so
+ * reading items does not involve any lookups. When the other source reports
+ * which of its items changed, only those are mapped again.
+ *
  * @since 5.71
  */
 class QUICKCHARTS_EXPORT MapProxySource : public ChartDataSource
@@ -47,8 +54,28 @@ public:
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
 
 private:
+    void updateMap();
+    void updateItems();
+    void mapItems(int start, int count);
+    void onSourceItemsChanged(int start, int count);
+    void onSourceItemsInserted(int start, int count);
+    void onSourceItemsRemoved(int start, int count);
+    void onSourceDataChanged();
+
     ChartDataSource *m_source = nullptr;
     QVariantMap m_map;
+
+    // Each key of the map is assigned an index into m_values and m_numbers.
+    QHash<QString, int> m_keys;
+    QVariantList m_values;
+    std::vector<qreal> m_numbers;
+    QVariant m_minimum;
+    QVariant m_maximum;
+
+    // The index of the mapped value of each item, or -1 if it is not mapped.
+    std::vector<int> m_indices;
+    bool m_sourceChangeKnown = false;
 };
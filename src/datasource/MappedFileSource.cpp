@@ -0,0 +1,369 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "MappedFileSource.h"
+
+#include <atomic>
+#include <cstring>
+
+#include <QFile>
+#include <QThread>
+#include <QtEndian>
+
+#include "charts_datasource_logging.h"
+
+static constexpr char headerMagic[] = {'K', 'Q', 'C', 'S'};
+static constexpr qint64 headerSize = 32;
+static constexpr quint32 headerVersion = 1;
+
+// The mapped file and everything determined from it. This is shared with the
+// loading thread, so the mapping remains valid even if the source is destroyed
+// while loading.
+struct MappedFileSource::Mapping {
+    QFile file;
+    const uchar *values = nullptr;
+    int count = 0;
+    int stride = 0;
+    ValueType type = Float64;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    QString error;
+
+    std::atomic<bool> cancelled = false;
+    std::atomic<double> progress = 0.0;
+
+    double value(int index) const
+    {
+        const auto data = values + qptrdiff(index) * stride;
+        return type == Float32 ? double(qFromLittleEndian<float>(data)) : qFromLittleEndian<double>(data);
+    }
+
+    bool open(const QString &fileName, bool hasHeader, ValueType valueType);
+    void index();
+};
+
+bool MappedFileSource::Mapping::open(const QString &fileName, bool hasHeader, ValueType valueType)
+{
+    file.setFileName(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        error = file.errorString();
+        return false;
+    }
+
+    const auto size = file.size();
+    if (size == 0) {
+        return true;
+    }
+
+    auto data = file.map(0, size);
+    if (!data) {
+        error = file.errorString();
+        return false;
+    }
+
+    qint64 valueCount = 0;
+    qint64 offset = 0;
+    type = valueType;
+    stride = type == Float32 ? sizeof(float) : sizeof(double);
+
+    if (hasHeader) {
+        if (size < headerSize || std::memcmp(data, headerMagic, sizeof(headerMagic)) != 0) {
+            error = QStringLiteral("File does not start with a valid header");
+            return false;
+        }
+
+        if (qFromLittleEndian<quint32>(data + 4) != headerVersion) {
+            error = QStringLiteral("Unsupported header version");
+            return false;
+        }
+
+        const auto headerType = qFromLittleEndian<quint32>(data + 8);
+        if (headerType > Float64) {
+            error = QStringLiteral("Unsupported value type");
+            return false;
+        }
+        type = ValueType(headerType);
+
+        const auto valueSize = type == Float32 ? sizeof(float) : sizeof(double);
+        const auto headerStride = qFromLittleEndian<quint32>(data + 12);
+        stride = headerStride == 0 ? valueSize : headerStride;
+        if (stride < int(valueSize)) {
+            error = QStringLiteral("Stride is smaller than the value type");
+            return false;
+        }
+
+        valueCount = qFromLittleEndian<quint64>(data + 16);
+        offset = qFromLittleEndian<quint64>(data + 24);
+        if (offset < 0 || offset > size || valueCount < 0 || (valueCount > 0 && (size - offset - qint64(valueSize)) / stride < valueCount - 1)) {
+            error = QStringLiteral("File is smaller than described by its header");
+            return false;
+        }
+    } else {
+        valueCount = size / stride;
+    }
+
+    if (valueCount > std::numeric_limits<int>::max()) {
+        qCWarning(DATASOURCE) << "MappedFileSource: File" << fileName << "contains more values than supported, only the first"
+                              << std::numeric_limits<int>::max() << "will be used";
+        valueCount = std::numeric_limits<int>::max();
+    }
+
+    values = data + offset;
+    count = valueCount;
+    return true;
+}
+
+void MappedFileSource::Mapping::index()
+{
+    if (count == 0) {
+        return;
+    }
+
+    minimum = std::numeric_limits<double>::max();
+    maximum = std::numeric_limits<double>::lowest();
+
+    constexpr int chunkSize = 1 << 20;
+    for (int start = 0; start < count; start += chunkSize) {
+        if (cancelled) {
+            return;
+        }
+
+        const auto end = std::min(count - start, chunkSize) + start;
+        for (int i = start; i < end; ++i) {
+            const auto v = value(i);
+            minimum = std::min(minimum, v);
+            maximum = std::max(maximum, v);
+        }
+
+        progress = double(end) / count;
+    }
+}
+
+MappedFileSource::MappedFileSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    m_progressTimer.setInterval(100);
+    connect(&m_progressTimer, &QTimer::timeout, this, &MappedFileSource::updateProgress);
+
+    connect(this, &MappedFileSource::fileNameChanged, this, &MappedFileSource::queueLoad);
+    connect(this, &MappedFileSource::hasHeaderChanged, this, &MappedFileSource::queueLoad);
+    connect(this, &MappedFileSource::valueTypeChanged, this, &MappedFileSource::queueLoad);
+}
+
+MappedFileSource::~MappedFileSource()
+{
+    if (m_loading) {
+        m_loading->cancelled = true;
+    }
+}
+
+QString MappedFileSource::fileName() const
+{
+    return m_fileName;
+}
+
+void MappedFileSource::setFileName(const QString &newFileName)
+{
+    if (newFileName == m_fileName) {
+        return;
+    }
+
+    m_fileName = newFileName;
+    Q_EMIT fileNameChanged();
+}
+
+bool MappedFileSource::hasHeader() const
+{
+    return m_hasHeader;
+}
+
+void MappedFileSource::setHasHeader(bool newHasHeader)
+{
+    if (newHasHeader == m_hasHeader) {
+        return;
+    }
+
+    m_hasHeader = newHasHeader;
+    Q_EMIT hasHeaderChanged();
+}
+
+MappedFileSource::ValueType MappedFileSource::valueType() const
+{
+    return m_valueType;
+}
+
+void MappedFileSource::setValueType(ValueType newValueType)
+{
+    if (newValueType == m_valueType) {
+        return;
+    }
+
+    m_valueType = newValueType;
+    Q_EMIT valueTypeChanged();
+}
+
+MappedFileSource::Status MappedFileSource::status() const
+{
+    return m_status;
+}
+
+QString MappedFileSource::errorString() const
+{
+    return m_errorString;
+}
+
+qreal MappedFileSource::progress() const
+{
+    return m_progress;
+}
+
+int MappedFileSource::itemCount() const
+{
+    return m_mapping ? m_mapping->count : 0;
+}
+
+QVariant MappedFileSource::item(int index) const
+{
+    if (!m_mapping || index < 0 || index >= m_mapping->count) {
+        return QVariant{};
+    }
+
+    return m_mapping->value(index);
+}
+
+QVariant MappedFileSource::minimum() const
+{
+    if (!m_mapping || m_mapping->count == 0) {
+        return QVariant{};
+    }
+
+    return m_mapping->minimum;
+}
+
+QVariant MappedFileSource::maximum() const
+{
+    if (!m_mapping || m_mapping->count == 0) {
+        return QVariant{};
+    }
+
+    return m_mapping->maximum;
+}
+
+void MappedFileSource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    if (!m_mapping) {
+        return;
+    }
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, m_mapping->count);
+    for (int i = first; i < last; ++i) {
+        output[i - start] = m_mapping->value(i);
+    }
+}
+
+void MappedFileSource::queueLoad()
+{
+    // Setting multiple properties, as happens when creating the source from
+    // QML, should only load the file once.
+    if (!m_loadQueued) {
+        m_loadQueued = true;
+        QMetaObject::invokeMethod(this, &MappedFileSource::load, Qt::QueuedConnection);
+    }
+}
+
+void MappedFileSource::load()
+{
+    m_loadQueued = false;
+
+    if (m_loading) {
+        m_loading->cancelled = true;
+        m_loading.reset();
+    }
+
+    m_mapping.reset();
+    m_errorString.clear();
+    m_progress = 0.0;
+    Q_EMIT progressChanged();
+
+    if (m_fileName.isEmpty()) {
+        m_progressTimer.stop();
+        setStatus(Null);
+        Q_EMIT dataChanged();
+        return;
+    }
+
+    setStatus(Loading);
+    Q_EMIT dataChanged();
+
+    auto mapping = std::make_shared<Mapping>();
+    m_loading = mapping;
+
+    auto thread = QThread::create([mapping, fileName = m_fileName, hasHeader = m_hasHeader, valueType = m_valueType]() {
+        if (mapping->open(fileName, hasHeader, valueType)) {
+            mapping->index();
+        }
+    });
+    connect(thread, &QThread::finished, this, [this, mapping]() {
+        onLoadFinished(mapping);
+    });
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+    thread->start();
+
+    m_progressTimer.start();
+}
+
+void MappedFileSource::onLoadFinished(const std::shared_ptr<Mapping> &mapping)
+{
+    // Loading a different file may have started in the meantime.
+    if (mapping != m_loading) {
+        return;
+    }
+
+    m_loading.reset();
+    m_progressTimer.stop();
+
+    if (!mapping->error.isEmpty()) {
+        qCWarning(DATASOURCE) << "MappedFileSource: Could not load" << m_fileName << mapping->error;
+        m_errorString = mapping->error;
+        setStatus(Error);
+        return;
+    }
+
+    m_mapping = mapping;
+    m_progress = 1.0;
+    Q_EMIT progressChanged();
+    setStatus(Ready);
+    Q_EMIT dataChanged();
+}
+
+void MappedFileSource::updateProgress()
+{
+    if (!m_loading) {
+        return;
+    }
+
+    const auto progress = m_loading->progress.load();
+    if (progress != m_progress) {
+        m_progress = progress;
+        Q_EMIT progressChanged();
+    }
+}
+
+void MappedFileSource::setStatus(Status newStatus)
+{
+    if (newStatus == m_status) {
+        return;
+    }
+
+    m_status = newStatus;
+    Q_EMIT statusChanged();
+}
+
+#include "moc_MappedFileSource.cpp"
@@ -0,0 +1,148 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef MAPPEDFILESOURCE_H
+#define MAPPEDFILESOURCE_H
+
+#include <memory>
+
+#include <QTimer>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that reads numbers from a memory-mapped file.
+ *
+ * This is intended for very large recorded datasets. Rather than reading the
+ * file, it is mapped into memory and items are read directly from the
+ * mapping, so only the parts of the file that are actually used are loaded.
+ *
+ * The file should contain little-endian floating point numbers of type
+ * \ref valueType, optionally preceded by a header if \ref hasHeader is true.
+ * The header is 32 bytes long and has the following layout, with all fields
+ * in little-endian byte order:
+ *
+ * | Offset | Size | Description                                            |
+ * |--------|------|--------------------------------------------------------|
+ * | 0      | 4    | The characters "KQCS".                                 |
+ * | 4      | 4    | Version, must be 1.                                    |
+ * | 8      | 4    | Value type, 0 for 32-bit and 1 for 64-bit floats.      |
+ * | 12     | 4    | Stride in bytes between values, 0 if tightly packed.   |
+ * | 16     | 8    | Number of values.                                      |
+ * | 24     | 8    | Offset in bytes of the first value from file start.    |
+ *
+ * Mapping the file and determining minimum and maximum happens on a
+ * background thread. Until that is done, \ref status is Loading and the source
+ * has no items. \ref progress indicates how far along loading is.
+ */
+class QUICKCHARTS_EXPORT MappedFileSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * The type of the numbers stored in the file.
+     */
+    enum ValueType {
+        Float32, ///< 32-bit floating point numbers.
+        Float64, ///< 64-bit floating point numbers.
+    };
+    Q_ENUM(ValueType)
+
+    /**
+     * The different states of the source.
+     */
+    enum Status {
+        Null, ///< No file has been set.
+        Loading, ///< The file is being loaded.
+        Ready, ///< The file has been loaded.
+        Error, ///< The file could not be loaded, see \ref errorString.
+    };
+    Q_ENUM(Status)
+
+    explicit MappedFileSource(QObject *parent = nullptr);
+    ~MappedFileSource() override;
+
+    /**
+     * The path of the file to read.
+     */
+    Q_PROPERTY(QString fileName READ fileName WRITE setFileName NOTIFY fileNameChanged)
+    QString fileName() const;
+    void setFileName(const QString &newFileName);
+    Q_SIGNAL void fileNameChanged();
+
+    /**
+     * Whether the file starts with a header.
+     *
+     * If true, the header determines value type, stride and number of values
+     * and \ref valueType is ignored. Defaults to false.
+     */
+    Q_PROPERTY(bool hasHeader READ hasHeader WRITE setHasHeader NOTIFY hasHeaderChanged)
+    bool hasHeader() const;
+    void setHasHeader(bool newHasHeader);
+    Q_SIGNAL void hasHeaderChanged();
+
+    /**
+     * The type of the numbers in a file without header.
+     *
+     * Defaults to Float64.
+     */
+    Q_PROPERTY(ValueType valueType READ valueType WRITE setValueType NOTIFY valueTypeChanged)
+    ValueType valueType() const;
+    void setValueType(ValueType newValueType);
+    Q_SIGNAL void valueTypeChanged();
+
+    /**
+     * The current status of the source.
+     */
+    Q_PROPERTY(Status status READ status NOTIFY statusChanged)
+    Status status() const;
+    Q_SIGNAL void statusChanged();
+
+    /**
+     * A description of the error if \ref status is Error.
+     */
+    Q_PROPERTY(QString errorString READ errorString NOTIFY statusChanged)
+    QString errorString() const;
+
+    /**
+     * How far along loading the file is, from 0.0 to 1.0.
+     */
+    Q_PROPERTY(qreal progress READ progress NOTIFY progressChanged)
+    qreal progress() const;
+    Q_SIGNAL void progressChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    struct Mapping;
+
+    void queueLoad();
+    void load();
+    void onLoadFinished(const std::shared_ptr<Mapping> &mapping);
+    void updateProgress();
+    void setStatus(Status newStatus);
+
+    QString m_fileName;
+    bool m_hasHeader = false;
+    ValueType m_valueType = Float64;
+    Status m_status = Null;
+    QString m_errorString;
+    qreal m_progress = 0.0;
+    bool m_loadQueued = false;
+
+    QTimer m_progressTimer;
+    std::shared_ptr<Mapping> m_loading;
+    std::shared_ptr<Mapping> m_mapping;
+};
+
+#endif // MAPPEDFILESOURCE_H
@@ -14,10 +14,19 @@
 ModelSource::ModelSource(QObject *parent)
     : ChartDataSource(parent)
 {
+    // These need to be connected before dataChanged so the cache is
+    // invalidated before anything reads from this source.
+    connect(this, &ModelSource::modelChanged, this, &ModelSource::invalidateCache);
+    connect(this, &ModelSource::columnChanged, this, &ModelSource::invalidateCache);
+    connect(this, &ModelSource::roleChanged, this, &ModelSource::invalidateCache);
+    connect(this, &ModelSource::indexColumnsChanged, this, &ModelSource::invalidateCache);
+    connect(this, &ModelSource::cachedChanged, this, &ModelSource::invalidateCache);
+
     connect(this, &ModelSource::modelChanged, this, &ModelSource::dataChanged);
     connect(this, &ModelSource::columnChanged, this, &ModelSource::dataChanged);
     connect(this, &ModelSource::roleChanged, this, &ModelSource::dataChanged);
     connect(this, &ModelSource::indexColumnsChanged, this, &ModelSource::dataChanged);
+    connect(this, &ModelSource::cachedChanged, this, &ModelSource::dataChanged);
 }
 
 int ModelSource::role() const
@@ -53,6 +62,11 @@ bool ModelSource::indexColumns() const
     return m_indexColumns;
 }
 
+bool ModelSource::cached() const
+{
+    return m_cached;
+}
+
 int ModelSource::itemCount() const
 {
     if (!m_model) {
@@ -68,19 +82,15 @@ QVariant ModelSource::item(int index) const
         return {};
     }
 
-    // For certain model (QML ListModel for example), the roleNames() are more
-    // dynamic and may only be valid when this method gets called. So try and
-    // lookup the role first before anything else.
-    if (m_role < 0) {
-        if (m_roleName.isEmpty()) {
+    if (m_cached && updateCache()) {
+        if (index < 0 || index >= m_cache.size()) {
             return QVariant{};
         }
+        return m_cache.at(index);
+    }
 
-        m_role = m_model->roleNames().key(m_roleName.toLatin1(), -1);
-        if (m_role < 0) {
-            qCWarning(DATASOURCE) << "ModelSource: Invalid role " << m_role << m_roleName;
-            return QVariant{};
-        }
+    if (!resolveRole()) {
+        return QVariant{};
     }
 
     if (!m_indexColumns && (m_column < 0 || m_column > m_model->columnCount())) {
@@ -96,6 +106,21 @@ QVariant ModelSource::item(int index) const
     return QVariant{};
 }
 
+void ModelSource::readValues(int start, int count, qreal *output) const
+{
+    if (m_cached && updateCache()) {
+        std::fill_n(output, count, 0.0);
+        const auto first = std::max(start, 0);
+        const auto last = std::min(start + count, int(m_cache.size()));
+        if (first < last) {
+            std::copy(m_cache.cbegin() + first, m_cache.cbegin() + last, output + (first - start));
+        }
+        return;
+    }
+
+    readModelValues(start, count, output);
+}
+
 QVariant ModelSource::minimum() const
 {
     if (!m_model || itemCount() <= 0) {
@@ -112,11 +137,17 @@ QVariant ModelSource::minimum() const
         return minProperty;
     }
 
-    QVariant result = std::numeric_limits<float>::max();
-    for (int i = 0; i < itemCount(); ++i) {
-        result = std::min(result, item(i), variantCompare);
-    }
-    return result;
+    return cachedMinimum([this]() {
+        if (m_cached && updateCache()) {
+            return QVariant{*std::min_element(m_cache.cbegin(), m_cache.cend())};
+        }
+
+        QVariant result = std::numeric_limits<float>::max();
+        for (int i = 0; i < itemCount(); ++i) {
+            result = std::min(result, item(i), variantCompare);
+        }
+        return result;
+    });
 }
 
 QVariant ModelSource::maximum() const
@@ -135,11 +166,17 @@ QVariant ModelSource::maximum() const
         return maxProperty;
     }
 
-    QVariant result = std::numeric_limits<float>::min();
-    for (int i = 0; i < itemCount(); ++i) {
-        result = std::max(result, item(i), variantCompare);
-    }
-    return result;
+    return cachedMaximum([this]() {
+        if (m_cached && updateCache()) {
+            return QVariant{*std::max_element(m_cache.cbegin(), m_cache.cend())};
+        }
+
+        QVariant result = std::numeric_limits<float>::min();
+        for (int i = 0; i < itemCount(); ++i) {
+            result = std::max(result, item(i), variantCompare);
+        }
+        return result;
+    });
 }
 
 void ModelSource::setRole(int role)
@@ -190,6 +227,16 @@ void ModelSource::setIndexColumns(bool index)
     Q_EMIT indexColumnsChanged();
 }
 
+void ModelSource::setCached(bool cached)
+{
+    if (cached == m_cached) {
+        return;
+    }
+
+    m_cached = cached;
+    Q_EMIT cachedChanged();
+}
+
 void ModelSource::setModel(QAbstractItemModel *model)
 {
     if (m_model == model) {
@@ -204,16 +251,20 @@ void ModelSource::setModel(QAbstractItemModel *model)
 
     m_model = model;
     if (m_model) {
-        connect(m_model, &QAbstractItemModel::rowsInserted, this, &ModelSource::dataChanged);
-        connect(m_model, &QAbstractItemModel::rowsRemoved, this, &ModelSource::dataChanged);
-        connect(m_model, &QAbstractItemModel::rowsMoved, this, &ModelSource::dataChanged);
-        connect(m_model, &QAbstractItemModel::modelReset, this, &ModelSource::dataChanged);
-        connect(m_model, &QAbstractItemModel::dataChanged, this, &ModelSource::dataChanged);
-        connect(m_model, &QAbstractItemModel::layoutChanged, this, &ModelSource::dataChanged);
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, &ModelSource::onRowsInserted);
+        connect(m_model, &QAbstractItemModel::rowsRemoved, this, &ModelSource::onRowsRemoved);
+        connect(m_model, &QAbstractItemModel::columnsInserted, this, &ModelSource::onColumnsInserted);
+        connect(m_model, &QAbstractItemModel::columnsRemoved, this, &ModelSource::onColumnsRemoved);
+        connect(m_model, &QAbstractItemModel::rowsMoved, this, &ModelSource::onModelReset);
+        connect(m_model, &QAbstractItemModel::columnsMoved, this, &ModelSource::onModelReset);
+        connect(m_model, &QAbstractItemModel::modelReset, this, &ModelSource::onModelReset);
+        connect(m_model, &QAbstractItemModel::dataChanged, this, &ModelSource::onModelDataChanged);
+        connect(m_model, &QAbstractItemModel::layoutChanged, this, &ModelSource::onModelReset);
 
         connect(m_model, &QAbstractItemModel::destroyed, this, [this]() {
             m_minimum = QVariant{};
             m_maximum = QVariant{};
+            invalidateCache();
             m_model = nullptr;
         });
 
@@ -241,6 +292,91 @@ void ModelSource::setModel(QAbstractItemModel *model)
     Q_EMIT modelChanged();
 }
 
+void ModelSource::onRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (!parent.isValid()) {
+        if (!m_indexColumns) {
+            insertCached(first, last - first + 1);
+            Q_EMIT itemsInserted(first, last - first + 1);
+        } else if (first == 0) {
+            invalidateCache();
+        }
+    }
+    Q_EMIT dataChanged();
+}
+
+void ModelSource::onRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!parent.isValid()) {
+        if (!m_indexColumns) {
+            removeCached(first, last - first + 1);
+            Q_EMIT itemsRemoved(first, last - first + 1);
+        } else if (first == 0) {
+            invalidateCache();
+        }
+    }
+    Q_EMIT dataChanged();
+}
+
+void ModelSource::onColumnsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    if (m_indexColumns) {
+        insertCached(first, last - first + 1);
+        Q_EMIT itemsInserted(first, last - first + 1);
+        Q_EMIT dataChanged();
+    } else if (first <= m_column) {
+        invalidateCache();
+        Q_EMIT dataChanged();
+    }
+}
+
+void ModelSource::onColumnsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    if (m_indexColumns) {
+        removeCached(first, last - first + 1);
+        Q_EMIT itemsRemoved(first, last - first + 1);
+        Q_EMIT dataChanged();
+    } else if (first <= m_column) {
+        invalidateCache();
+        Q_EMIT dataChanged();
+    }
+}
+
+void ModelSource::onModelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles)
+{
+    if (!topLeft.parent().isValid()) {
+        const auto affectsRole = roles.isEmpty() || m_role < 0 || roles.contains(m_role);
+        if (m_indexColumns) {
+            if (topLeft.row() == 0) {
+                if (affectsRole) {
+                    refreshCached(topLeft.column(), bottomRight.column() - topLeft.column() + 1);
+                }
+                Q_EMIT itemsChanged(topLeft.column(), bottomRight.column() - topLeft.column() + 1);
+            }
+        } else {
+            if (affectsRole && topLeft.column() <= m_column && bottomRight.column() >= m_column) {
+                refreshCached(topLeft.row(), bottomRight.row() - topLeft.row() + 1);
+            }
+            Q_EMIT itemsChanged(topLeft.row(), bottomRight.row() - topLeft.row() + 1);
+        }
+    }
+    Q_EMIT dataChanged();
+}
+
+void ModelSource::onModelReset()
+{
+    invalidateCache();
+    Q_EMIT dataChanged();
+}
+
 void ModelSource::onMinimumChanged()
 {
     auto newMinimum = m_model->property("minimum");
@@ -257,4 +393,123 @@ void ModelSource::onMaximumChanged()
     }
 }
 
+bool ModelSource::resolveRole() const
+{
+    if (m_role >= 0) {
+        return true;
+    }
+
+    // For certain model (QML ListModel for example), the roleNames() are more
+    // dynamic and may only be valid when this method gets called. So try and
+    // lookup the role first before anything else.
+    if (m_roleName.isEmpty()) {
+        return false;
+    }
+
+    m_role = m_model->roleNames().key(m_roleName.toLatin1(), -1);
+    if (m_role < 0) {
+        qCWarning(DATASOURCE) << "ModelSource: Invalid role " << m_role << m_roleName;
+        return false;
+    }
+
+    return true;
+}
+
+bool ModelSource::readModelValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    if (!m_model) {
+        return false;
+    }
+
+    // Resolve role and column once rather than for every item.
+    if (!resolveRole()) {
+        return false;
+    }
+
+    if (!m_indexColumns && (m_column < 0 || m_column > m_model->columnCount())) {
+        qCDebug(DATASOURCE) << "ModelSource: Invalid column" << m_column;
+        return false;
+    }
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, itemCount());
+    for (int i = first; i < last; ++i) {
+        auto modelIndex = m_indexColumns ? m_model->index(0, i) : m_model->index(i, m_column);
+        if (modelIndex.isValid()) {
+            output[i - start] = m_model->data(modelIndex, m_role).toDouble();
+        }
+    }
+
+    return true;
+}
+
+bool ModelSource::updateCache() const
+{
+    if (m_cacheValid) {
+        return true;
+    }
+
+    if (!m_model) {
+        return false;
+    }
+
+    m_cache.resize(itemCount());
+    m_cacheValid = readModelValues(0, m_cache.size(), m_cache.data());
+    if (!m_cacheValid) {
+        m_cache.clear();
+    }
+    return m_cacheValid;
+}
+
+void ModelSource::insertCached(int first, int count)
+{
+    if (!m_cacheValid) {
+        return;
+    }
+
+    if (first < 0 || first > m_cache.size()) {
+        invalidateCache();
+        return;
+    }
+
+    m_cache.insert(first, count, 0.0);
+    readModelValues(first, count, m_cache.data() + first);
+}
+
+void ModelSource::removeCached(int first, int count)
+{
+    if (!m_cacheValid) {
+        return;
+    }
+
+    if (first < 0 || first + count > m_cache.size()) {
+        invalidateCache();
+        return;
+    }
+
+    m_cache.remove(first, count);
+}
+
+void ModelSource::refreshCached(int first, int count)
+{
+    if (!m_cacheValid) {
+        return;
+    }
+
+    if (first < 0 || first + count > m_cache.size()) {
+        invalidateCache();
+        return;
+    }
+
+    readModelValues(first, count, m_cache.data() + first);
+}
+
+void ModelSource::invalidateCache()
+{
+    m_cacheValid = false;
+    m_cache.clear();
+}
+
 #include "moc_ModelSource.cpp"
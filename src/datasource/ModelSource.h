@@ -16,7 +16,9 @@
 /**
  * A data source that reads data from a QAbstractItemModel.
  *
- *
+ * By default, every item is read from the model when it is requested. For
+ * large models with numeric data, \ref cached can be enabled to read the
+ * items once and keep them up to date based on the model's signals.
  */
 class QUICKCHARTS_EXPORT ModelSource : public ChartDataSource
 {
@@ -51,15 +53,45 @@ public:
     void setIndexColumns(bool index);
     Q_SIGNAL void indexColumnsChanged();
 
+    /**
+     * Cache the items of this source as numbers.
+     *
+     * When enabled, the items are read from the model once and stored as
+     * numbers. The cached items are updated when rows are inserted, removed or
+     * changed, so reading items does not need to access the model. This should
+     * only be used for numeric data, as all items will be returned as numbers.
+     *
+     * Defaults to false.
+     */
+    Q_PROPERTY(bool cached READ cached WRITE setCached NOTIFY cachedChanged)
+    bool cached() const;
+    void setCached(bool cached);
+    Q_SIGNAL void cachedChanged();
+
     int itemCount() const override;
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
 
 private:
+    void onRowsInserted(const QModelIndex &parent, int first, int last);
+    void onRowsRemoved(const QModelIndex &parent, int first, int last);
+    void onColumnsInserted(const QModelIndex &parent, int first, int last);
+    void onColumnsRemoved(const QModelIndex &parent, int first, int last);
+    void onModelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles);
+    void onModelReset();
     Q_SLOT void onMinimumChanged();
     Q_SLOT void onMaximumChanged();
 
+    bool resolveRole() const;
+    bool readModelValues(int start, int count, qreal *output) const;
+    bool updateCache() const;
+    void insertCached(int first, int count);
+    void removeCached(int first, int count);
+    void refreshCached(int first, int count);
+    void invalidateCache();
+
     mutable int m_role = -1;
     QString m_roleName;
     int m_column = 0;
@@ -68,6 +100,10 @@ private:
 
     QVariant m_minimum;
     QVariant m_maximum;
+
+    bool m_cached = false;
+    mutable bool m_cacheValid = false;
+    mutable QList<qreal> m_cache;
 };
 
 #endif // MODELSOURCE_H
@@ -0,0 +1,467 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "MultiResolutionProxySource.h"
+
+#include <vector>
+
+#include <QMutex>
+#include <QThreadPool>
+
+// Sources with more items than this have their index built on a separate
+// thread.
+static constexpr int backgroundThreshold = 1 << 16;
+
+// The index of a source. Each level contains buckets of twice the size of the
+// previous level, each calculated from two buckets of the previous level. The
+// first level contains buckets of two items of the source.
+struct MultiResolutionProxySource::Pyramid {
+    struct Bucket {
+        qreal minimum = 0.0;
+        qreal maximum = 0.0;
+        qreal sum = 0.0;
+    };
+
+    std::vector<std::vector<Bucket>> levels;
+    int count = 0;
+
+    void update(const qreal *values, int start, int end, int newCount);
+};
+
+// Recalculate the buckets containing items start to end of a source with
+// newCount items. values contains the items of the source from the start of
+// the first bucket to the end of the last bucket of the first level.
+void MultiResolutionProxySource::Pyramid::update(const qreal *values, int start, int end, int newCount)
+{
+    count = newCount;
+    if (start >= end) {
+        return;
+    }
+
+    const auto valuesStart = start & ~1;
+    auto first = start / 2;
+    auto last = (end - 1) / 2;
+    auto childCount = newCount;
+
+    for (std::size_t level = 0; childCount > 1; ++level) {
+        if (level == levels.size()) {
+            levels.emplace_back();
+        }
+
+        auto &buckets = levels[level];
+        const auto size = (childCount + 1) / 2;
+        buckets.resize(size);
+
+        for (auto bucket = first; bucket <= last; ++bucket) {
+            const auto child = bucket * 2;
+            const auto hasSecond = child + 1 < childCount;
+
+            Bucket result;
+            if (level == 0) {
+                const auto value = values[child - valuesStart];
+                result = {value, value, value};
+                if (hasSecond) {
+                    const auto second = values[child + 1 - valuesStart];
+                    result.minimum = std::min(result.minimum, second);
+                    result.maximum = std::max(result.maximum, second);
+                    result.sum += second;
+                }
+            } else {
+                const auto &children = levels[level - 1];
+                result = children[child];
+                if (hasSecond) {
+                    const auto &second = children[child + 1];
+                    result.minimum = std::min(result.minimum, second.minimum);
+                    result.maximum = std::max(result.maximum, second.maximum);
+                    result.sum += second.sum;
+                }
+            }
+            buckets[bucket] = result;
+        }
+
+        first /= 2;
+        last /= 2;
+        childCount = size;
+    }
+}
+
+// An index being built on a separate thread, from a copy of the items of the
+// source.
+struct MultiResolutionProxySource::Build {
+    std::vector<qreal> values;
+    Pyramid pyramid;
+};
+
+// Shared with running builds, so they can deliver their result as long as the
+// source exists.
+struct MultiResolutionProxySource::Shared {
+    QMutex mutex;
+    MultiResolutionProxySource *owner = nullptr;
+};
+
+MultiResolutionProxySource::MultiResolutionProxySource(QObject *parent)
+    : ChartDataSource(parent)
+    , m_shared(std::make_shared<Shared>())
+{
+    m_shared->owner = this;
+
+    connect(this, &MultiResolutionProxySource::sourceChanged, this, &MultiResolutionProxySource::rebuild);
+    connect(this, &MultiResolutionProxySource::fromChanged, this, &MultiResolutionProxySource::update);
+    connect(this, &MultiResolutionProxySource::toChanged, this, &MultiResolutionProxySource::update);
+    connect(this, &MultiResolutionProxySource::maximumItemsChanged, this, &MultiResolutionProxySource::update);
+    connect(this, &MultiResolutionProxySource::modeChanged, this, &MultiResolutionProxySource::update);
+}
+
+MultiResolutionProxySource::~MultiResolutionProxySource()
+{
+    // Once this returns, running builds can no longer reach this object.
+    QMutexLocker locker(&m_shared->mutex);
+    m_shared->owner = nullptr;
+}
+
+ChartDataSource *MultiResolutionProxySource::source() const
+{
+    return m_source;
+}
+
+void MultiResolutionProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &MultiResolutionProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            rebuild();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int MultiResolutionProxySource::from() const
+{
+    return m_from;
+}
+
+void MultiResolutionProxySource::setFrom(int newFrom)
+{
+    if (newFrom == m_from) {
+        return;
+    }
+
+    m_from = newFrom;
+    Q_EMIT fromChanged();
+}
+
+int MultiResolutionProxySource::to() const
+{
+    return m_to;
+}
+
+void MultiResolutionProxySource::setTo(int newTo)
+{
+    if (newTo == m_to) {
+        return;
+    }
+
+    m_to = newTo;
+    Q_EMIT toChanged();
+}
+
+int MultiResolutionProxySource::maximumItems() const
+{
+    return m_maximumItems;
+}
+
+void MultiResolutionProxySource::setMaximumItems(int newMaximumItems)
+{
+    if (newMaximumItems == m_maximumItems) {
+        return;
+    }
+
+    m_maximumItems = newMaximumItems;
+    Q_EMIT maximumItemsChanged();
+}
+
+MultiResolutionProxySource::Mode MultiResolutionProxySource::mode() const
+{
+    return m_mode;
+}
+
+void MultiResolutionProxySource::setMode(Mode newMode)
+{
+    if (newMode == m_mode) {
+        return;
+    }
+
+    m_mode = newMode;
+    Q_EMIT modeChanged();
+}
+
+int MultiResolutionProxySource::bucketSize() const
+{
+    return m_bucketSize;
+}
+
+int MultiResolutionProxySource::sourceIndex(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return -1;
+    }
+
+    const auto itemsPerBucket = m_bucketSize > 1 && m_mode == MinMax ? 2 : 1;
+    return m_start + (index / itemsPerBucket) * m_bucketSize;
+}
+
+int MultiResolutionProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant MultiResolutionProxySource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant MultiResolutionProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant MultiResolutionProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_values.cbegin(), m_values.cend());
+        if (itr != m_values.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void MultiResolutionProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_values.size()));
+    if (first < last) {
+        std::copy(m_values.cbegin() + first, m_values.cbegin() + last, output + (first - start));
+    }
+}
+
+void MultiResolutionProxySource::rebuild()
+{
+    m_sourceCount = m_source ? m_source->itemCount() : 0;
+
+    // Only one build runs at a time. The current index remains visible until
+    // the running build is done, after which a new one is started.
+    if (m_build) {
+        m_rebuildPending = true;
+        update();
+        return;
+    }
+
+    // The items are copied so the index can be built without accessing the
+    // source, which is only cheap compared to building it for large sources.
+    std::vector<qreal> values(m_sourceCount);
+    if (m_sourceCount > 0) {
+        m_source->readValues(0, m_sourceCount, values.data());
+    }
+
+    if (m_sourceCount <= backgroundThreshold) {
+        m_pyramid = std::make_unique<Pyramid>();
+        m_pyramid->update(values.data(), 0, m_sourceCount, m_sourceCount);
+        update();
+        return;
+    }
+
+    auto build = std::make_shared<Build>();
+    build->values = std::move(values);
+    m_build = build;
+
+    QThreadPool::globalInstance()->start([shared = m_shared, build]() {
+        const auto count = int(build->values.size());
+        build->pyramid.update(build->values.data(), 0, count, count);
+        build->values = std::vector<qreal>{};
+
+        QMutexLocker locker(&shared->mutex);
+        if (shared->owner) {
+            QMetaObject::invokeMethod(
+                shared->owner,
+                [owner = shared->owner, build]() {
+                    owner->onBuildFinished(build);
+                },
+                Qt::QueuedConnection);
+        }
+    });
+
+    update();
+}
+
+void MultiResolutionProxySource::onBuildFinished(const std::shared_ptr<Build> &build)
+{
+    if (build != m_build) {
+        return;
+    }
+
+    // Even if the source changed in the meantime, the new index is closer to
+    // the source than the previous one, so use it until the next one is done.
+    m_build.reset();
+    m_pyramid = std::make_unique<Pyramid>(std::move(build->pyramid));
+
+    if (m_rebuildPending) {
+        m_rebuildPending = false;
+        rebuild();
+        return;
+    }
+
+    // Add anything that was appended while building.
+    if (m_sourceCount > m_pyramid->count) {
+        updatePyramid(m_pyramid->count, m_sourceCount, m_sourceCount);
+    }
+
+    update();
+}
+
+void MultiResolutionProxySource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+
+    const auto appended = !change.isReset() && change.itemCountChanged && change.start == m_sourceCount && count > m_sourceCount;
+    const auto changed = !change.isReset() && !change.itemCountChanged && count == m_sourceCount;
+
+    if (m_build) {
+        // Appended items are added once building is done, anything else
+        // invalidates the copy being used, so build again once it is done.
+        if (!appended) {
+            m_rebuildPending = true;
+        }
+    } else if (m_pyramid && appended) {
+        updatePyramid(m_sourceCount, count, count);
+    } else if (m_pyramid && changed) {
+        updatePyramid(change.start, std::min(change.start + change.count, count), count);
+    } else {
+        rebuild();
+        return;
+    }
+
+    m_sourceCount = count;
+    update();
+}
+
+void MultiResolutionProxySource::updatePyramid(int start, int end, int count)
+{
+    // Buckets of the first level contain two items, so read from the start of
+    // the first affected bucket to the end of the last one.
+    const auto valuesStart = start & ~1;
+    const auto valuesEnd = std::min((end + 1) & ~1, count);
+
+    std::vector<qreal> values(std::max(valuesEnd - valuesStart, 0));
+    if (!values.empty()) {
+        m_source->readValues(valuesStart, int(values.size()), values.data());
+    }
+    m_pyramid->update(values.data(), start, end, count);
+}
+
+void MultiResolutionProxySource::update()
+{
+    const auto count = m_sourceCount;
+    const auto from = std::clamp(m_from, 0, count);
+    const auto to = m_to < 0 ? count : std::clamp(m_to, from, count);
+    const auto itemsPerBucket = m_mode == MinMax ? 2 : 1;
+    const auto maximumItems = std::max(m_maximumItems, itemsPerBucket);
+
+    // Use the smallest bucket size that results in few enough items. The
+    // largest bucket size contains all items, so this always ends.
+    auto bucketSize = 1;
+    std::size_t level = 0;
+    if (to - from > maximumItems) {
+        bucketSize = 2;
+        level = 1;
+        while (qint64((to - 1) / bucketSize - from / bucketSize + 1) * itemsPerBucket > maximumItems) {
+            bucketSize *= 2;
+            level++;
+        }
+    }
+
+    m_values.clear();
+    if (bucketSize == 1) {
+        m_start = from;
+        m_values.resize(to - from);
+        if (!m_values.isEmpty()) {
+            m_source->readValues(from, m_values.size(), m_values.data());
+        }
+    } else {
+        const auto first = from / bucketSize;
+        const auto last = (to - 1) / bucketSize;
+        m_start = first * bucketSize;
+        m_values.reserve((last - first + 1) * itemsPerBucket);
+
+        // While the index is being built, it may be outdated or not exist
+        // yet. Buckets that it does not contain show the first item of the
+        // bucket instead, so the chart is never empty.
+        const auto hasLevel = m_pyramid && level <= m_pyramid->levels.size();
+        const auto indexedCount = hasLevel ? m_pyramid->count : 0;
+
+        for (auto index = first; index <= last; ++index) {
+            if (index * bucketSize >= indexedCount) {
+                qreal value = 0.0;
+                m_source->readValues(index * bucketSize, 1, &value);
+                m_values.append(value);
+                if (m_mode == MinMax) {
+                    m_values.append(value);
+                }
+                continue;
+            }
+
+            const auto &bucket = m_pyramid->levels[level - 1][index];
+            switch (m_mode) {
+            case MinMax:
+                m_values.append(bucket.minimum);
+                m_values.append(bucket.maximum);
+                break;
+            case Mean:
+                m_values.append(bucket.sum / std::min(bucketSize, indexedCount - index * bucketSize));
+                break;
+            case Minimum:
+                m_values.append(bucket.minimum);
+                break;
+            case Maximum:
+                m_values.append(bucket.maximum);
+                break;
+            }
+        }
+    }
+
+    if (bucketSize != m_bucketSize) {
+        m_bucketSize = bucketSize;
+        Q_EMIT bucketSizeChanged();
+    }
+
+    Q_EMIT dataChanged();
+}
+
+#include "moc_MultiResolutionProxySource.cpp"
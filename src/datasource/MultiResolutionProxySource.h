@@ -0,0 +1,162 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef MULTIRESOLUTIONPROXYSOURCE_H
+#define MULTIRESOLUTIONPROXYSOURCE_H
+
+#include <memory>
+
+#include <QList>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that shows a range of a different data source at a suitable
+ * resolution.
+ *
+ * This source builds an index of another source, containing the minimum,
+ * maximum and mean of buckets of 2, 4, 8 and so on items. It provides the items
+ * of the source between \ref from and \ref to, using the smallest bucket size
+ * that results in at most \ref maximumItems items. This means the amount of
+ * work needed to change the range, for example when zooming a chart, only
+ * depends on the number of items provided, not on the number of items of the
+ * source. Ranges that are small enough are provided using the items of the
+ * source as-is.
+ *
+ * For large sources, the index is built using the global thread pool. Until
+ * it is done, the previous index is used, and buckets it does not contain are
+ * represented by their first item. Only one build runs at a time; changes
+ * made while it runs result in a single new build once it is done. When items
+ * are appended to the source or change, only the affected buckets are
+ * recalculated.
+ *
+ * Note that items of this source are evenly spaced when used with a chart.
+ * \ref sourceIndex can be used to determine the position of an item in the
+ * source.
+ */
+class QUICKCHARTS_EXPORT MultiResolutionProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * What is provided for each bucket.
+     */
+    enum Mode {
+        MinMax, ///< The minimum followed by the maximum, using two items per bucket.
+        Mean, ///< The average.
+        Minimum, ///< The minimum.
+        Maximum, ///< The maximum.
+    };
+    Q_ENUM(Mode)
+
+    explicit MultiResolutionProxySource(QObject *parent = nullptr);
+    ~MultiResolutionProxySource() override;
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The index of the first item of the source to provide.
+     *
+     * Defaults to 0.
+     */
+    Q_PROPERTY(int from READ from WRITE setFrom NOTIFY fromChanged)
+    int from() const;
+    void setFrom(int newFrom);
+    Q_SIGNAL void fromChanged();
+
+    /**
+     * The index after the last item of the source to provide.
+     *
+     * If this is -1, items up to the end of the source are provided. Defaults
+     * to -1.
+     */
+    Q_PROPERTY(int to READ to WRITE setTo NOTIFY toChanged)
+    int to() const;
+    void setTo(int newTo);
+    Q_SIGNAL void toChanged();
+
+    /**
+     * The maximum number of items this source provides.
+     *
+     * This should usually be set to the width of the chart in pixels or a bit
+     * more. Defaults to 1000.
+     */
+    Q_PROPERTY(int maximumItems READ maximumItems WRITE setMaximumItems NOTIFY maximumItemsChanged)
+    int maximumItems() const;
+    void setMaximumItems(int newMaximumItems);
+    Q_SIGNAL void maximumItemsChanged();
+
+    /**
+     * What is provided for each bucket.
+     *
+     * Defaults to MinMax.
+     */
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY modeChanged)
+    Mode mode() const;
+    void setMode(Mode newMode);
+    Q_SIGNAL void modeChanged();
+
+    /**
+     * The number of items of the source represented by each bucket.
+     *
+     * This is 1 if the items of the source are provided as-is.
+     */
+    Q_PROPERTY(int bucketSize READ bucketSize NOTIFY bucketSizeChanged)
+    int bucketSize() const;
+    Q_SIGNAL void bucketSizeChanged();
+
+    /**
+     * The index of the first item of the source represented by \p index.
+     *
+     * Returns -1 if \p index is not a valid item of this source.
+     */
+    Q_INVOKABLE int sourceIndex(int index) const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    struct Pyramid;
+    struct Build;
+    struct Shared;
+
+    void rebuild();
+    void onBuildFinished(const std::shared_ptr<Build> &build);
+    void onSourceDataChanged();
+    void updatePyramid(int start, int end, int count);
+    void update();
+
+    ChartDataSource *m_source = nullptr;
+    int m_from = 0;
+    int m_to = -1;
+    int m_maximumItems = 1000;
+    Mode m_mode = MinMax;
+
+    std::unique_ptr<Pyramid> m_pyramid;
+    // The build that is running, if any.
+    std::shared_ptr<Build> m_build;
+    bool m_rebuildPending = false;
+    std::shared_ptr<Shared> m_shared;
+    int m_sourceCount = 0;
+
+    int m_start = 0;
+    int m_bucketSize = 1;
+    QList<qreal> m_values;
+};
+
+#endif // MULTIRESOLUTIONPROXYSOURCE_H
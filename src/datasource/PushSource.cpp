@@ -0,0 +1,83 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "PushSource.h"
+
+#include <bit>
+
+PushSource::PushSource(QObject *parent)
+    : HistorySource(parent)
+{
+    setQueueSize(65536);
+
+    // Check for new values once per frame. Polling means push() does not need
+    // to wake this thread, which would lock and allocate.
+    m_drainTimer.setInterval(16);
+    connect(&m_drainTimer, &QTimer::timeout, this, &PushSource::drain);
+    m_drainTimer.start();
+}
+
+int PushSource::queueSize() const
+{
+    return int(m_queue.size());
+}
+
+void PushSource::setQueueSize(int newQueueSize)
+{
+    // A power of two allows using a mask rather than modulo.
+    const auto size = std::bit_ceil(quint64(std::clamp(newQueueSize, 1, 1 << 30)));
+    if (size == m_queue.size()) {
+        return;
+    }
+
+    drain();
+
+    m_queue.assign(size, 0.0);
+    m_mask = size - 1;
+    m_writeCount = 0;
+    m_readCount = 0;
+    Q_EMIT queueSizeChanged();
+}
+
+qsizetype PushSource::push(std::span<const qreal> values)
+{
+    const auto write = m_writeCount.load(std::memory_order_relaxed);
+    const auto read = m_readCount.load(std::memory_order_acquire);
+
+    const auto count = std::min<quint64>(values.size(), m_queue.size() - (write - read));
+    for (quint64 i = 0; i < count; ++i) {
+        m_queue[(write + i) & m_mask] = values[i];
+    }
+    m_writeCount.store(write + count, std::memory_order_release);
+
+    return count;
+}
+
+bool PushSource::push(qreal value)
+{
+    return push(std::span<const qreal>(&value, 1)) == 1;
+}
+
+void PushSource::drain()
+{
+    const auto read = m_readCount.load(std::memory_order_relaxed);
+    const auto write = m_writeCount.load(std::memory_order_acquire);
+    const auto count = int(write - read);
+    if (count <= 0) {
+        return;
+    }
+
+    std::vector<qreal> values(count);
+    for (int i = 0; i < count; ++i) {
+        values[i] = m_queue[(read + i) & m_mask];
+    }
+    m_readCount.store(write, std::memory_order_release);
+
+    appendValues(values.data(), count);
+}
+
+#include "moc_PushSource.cpp"
@@ -0,0 +1,83 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef PUSHSOURCE_H
+#define PUSHSOURCE_H
+
+#include <atomic>
+#include <span>
+#include <vector>
+
+#include <QTimer>
+
+#include "HistorySource.h"
+
+/**
+ * A data source that receives values pushed from a different thread.
+ *
+ * Values are pushed into a lock-free single-producer, single-consumer queue
+ * using push(), which can be called from any one thread at a time. The thread
+ * this source lives in checks the queue once per frame, like
+ * \ref SharedMemorySource does, and empties it, emitting a single change for
+ * all values pushed in the meantime. The pushing thread never has to notify
+ * the other thread.
+ *
+ * Values are stored like \ref HistoryProxySource does, with the most recent
+ * value as item 0 and at most \ref maximumHistory values.
+ *
+ * The source should not be destroyed while a different thread may push to it.
+ */
+class QUICKCHARTS_EXPORT PushSource : public HistorySource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit PushSource(QObject *parent = nullptr);
+
+    /**
+     * The number of values that can be queued before they are added.
+     *
+     * Values pushed while the queue is full are discarded. This should only be
+     * changed when no thread is pushing values. Defaults to 65536.
+     */
+    Q_PROPERTY(int queueSize READ queueSize WRITE setQueueSize NOTIFY queueSizeChanged)
+    int queueSize() const;
+    void setQueueSize(int newQueueSize);
+    Q_SIGNAL void queueSizeChanged();
+
+    /**
+     * Queue \p values to be added to this source, ordered from oldest to newest.
+     *
+     * This is thread-safe as long as only a single thread calls it at the
+     * same time. It does not lock, allocate or post events, so it can be
+     * called from real-time threads.
+     *
+     * \return The number of values queued, which is less than the number of
+     *         values if the queue is full.
+     */
+    qsizetype push(std::span<const qreal> values);
+    /**
+     * Queue a single value.
+     *
+     * \overload
+     */
+    bool push(qreal value);
+
+private:
+    void drain();
+
+    std::vector<qreal> m_queue;
+    quint64 m_mask = 0;
+    // Total number of values written and read, the position in the queue is
+    // these modulo the queue size.
+    std::atomic<quint64> m_writeCount = 0;
+    std::atomic<quint64> m_readCount = 0;
+    QTimer m_drainTimer;
+};
+
+#endif // PUSHSOURCE_H
@@ -0,0 +1,297 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "QuantileProxySource.h"
+
+static QVariant valueAt(const std::vector<qreal> &values, int index)
+{
+    if (index < 0 || index >= int(values.size())) {
+        return QVariant{};
+    }
+    return values[index];
+}
+
+static void readRange(const std::vector<qreal> &values, int start, int count, qreal *output)
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(values.size()));
+    if (first < last) {
+        std::copy(values.cbegin() + first, values.cbegin() + last, output + (first - start));
+    }
+}
+
+QuantileSeriesSource::QuantileSeriesSource(QuantileProxySource *proxy, int index)
+    : ChartDataSource(proxy)
+    , m_proxy(proxy)
+    , m_index(index)
+{
+}
+
+qreal QuantileSeriesSource::quantile() const
+{
+    return m_proxy->m_quantiles.at(m_index);
+}
+
+int QuantileSeriesSource::itemCount() const
+{
+    return m_proxy->m_values[m_index].size();
+}
+
+QVariant QuantileSeriesSource::item(int index) const
+{
+    return valueAt(m_proxy->m_values[m_index], index);
+}
+
+QVariant QuantileSeriesSource::minimum() const
+{
+    return cachedMinimum([this]() {
+        const auto &values = m_proxy->m_values[m_index];
+        auto itr = std::min_element(values.cbegin(), values.cend());
+        return itr != values.cend() ? QVariant{*itr} : QVariant{};
+    });
+}
+
+QVariant QuantileSeriesSource::maximum() const
+{
+    return cachedMaximum([this]() {
+        const auto &values = m_proxy->m_values[m_index];
+        auto itr = std::max_element(values.cbegin(), values.cend());
+        return itr != values.cend() ? QVariant{*itr} : QVariant{};
+    });
+}
+
+void QuantileSeriesSource::readValues(int start, int count, qreal *output) const
+{
+    readRange(m_proxy->m_values[m_index], start, count, output);
+}
+
+QuantileProxySource::QuantileProxySource(QObject *parent)
+    : ChartDataSource(parent)
+    , m_bucket(m_compression)
+    , m_total(m_compression)
+{
+    updateSeries();
+
+    connect(this, &QuantileProxySource::sourceChanged, this, &QuantileProxySource::recalculate);
+    connect(this, &QuantileProxySource::bucketSizeChanged, this, &QuantileProxySource::recalculate);
+    connect(this, &QuantileProxySource::compressionChanged, this, &QuantileProxySource::recalculate);
+    connect(this, &QuantileProxySource::quantilesChanged, this, &QuantileProxySource::updateSeries);
+}
+
+ChartDataSource *QuantileProxySource::source() const
+{
+    return m_source;
+}
+
+void QuantileProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &QuantileProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            recalculate();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int QuantileProxySource::bucketSize() const
+{
+    return m_bucketSize;
+}
+
+void QuantileProxySource::setBucketSize(int newBucketSize)
+{
+    newBucketSize = std::max(newBucketSize, 1);
+    if (newBucketSize == m_bucketSize) {
+        return;
+    }
+
+    m_bucketSize = newBucketSize;
+    Q_EMIT bucketSizeChanged();
+}
+
+QList<qreal> QuantileProxySource::quantiles() const
+{
+    return m_quantiles;
+}
+
+void QuantileProxySource::setQuantiles(const QList<qreal> &newQuantiles)
+{
+    if (newQuantiles == m_quantiles) {
+        return;
+    }
+
+    m_quantiles = newQuantiles;
+    Q_EMIT quantilesChanged();
+}
+
+qreal QuantileProxySource::compression() const
+{
+    return m_compression;
+}
+
+void QuantileProxySource::setCompression(qreal newCompression)
+{
+    if (qFuzzyCompare(newCompression, m_compression)) {
+        return;
+    }
+
+    m_compression = newCompression;
+    Q_EMIT compressionChanged();
+}
+
+QList<ChartDataSource *> QuantileProxySource::series() const
+{
+    QList<ChartDataSource *> result;
+    result.reserve(m_series.size());
+    std::copy(m_series.cbegin(), m_series.cend(), std::back_inserter(result));
+    return result;
+}
+
+qreal QuantileProxySource::totalQuantile(qreal q) const
+{
+    auto total = m_total;
+    total.merge(m_bucket);
+    return total.quantile(q);
+}
+
+int QuantileProxySource::itemCount() const
+{
+    return m_values.empty() ? 0 : m_values.front().size();
+}
+
+QVariant QuantileProxySource::item(int index) const
+{
+    return m_values.empty() ? QVariant{} : valueAt(m_values.front(), index);
+}
+
+QVariant QuantileProxySource::minimum() const
+{
+    return m_series.isEmpty() ? QVariant{} : m_series.first()->minimum();
+}
+
+QVariant QuantileProxySource::maximum() const
+{
+    return m_series.isEmpty() ? QVariant{} : m_series.first()->maximum();
+}
+
+void QuantileProxySource::readValues(int start, int count, qreal *output) const
+{
+    if (m_values.empty()) {
+        std::fill_n(output, count, 0.0);
+        return;
+    }
+
+    readRange(m_values.front(), start, count, output);
+}
+
+void QuantileProxySource::updateSeries()
+{
+    qDeleteAll(m_series);
+    m_series.clear();
+
+    for (int i = 0; i < m_quantiles.size(); ++i) {
+        m_series.append(new QuantileSeriesSource(this, i));
+    }
+
+    recalculate();
+    Q_EMIT seriesChanged();
+}
+
+void QuantileProxySource::recalculate()
+{
+    m_bucket = QuantileSketch(m_compression);
+    m_total = QuantileSketch(m_compression);
+    m_values.assign(m_quantiles.size(), std::vector<qreal>{});
+    m_sourceCount = 0;
+
+    const auto count = m_source ? m_source->itemCount() : 0;
+    if (count > 0) {
+        std::vector<qreal> values(count);
+        m_source->readValues(0, count, values.data());
+        addValues(values);
+    }
+
+    Q_EMIT dataChanged();
+    for (auto series : std::as_const(m_series)) {
+        Q_EMIT series->dataChanged();
+    }
+}
+
+void QuantileProxySource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+
+    // Only appending items can be handled without recalculating everything.
+    const auto appended = !change.isReset() && change.itemCountChanged && change.start == m_sourceCount && count > m_sourceCount;
+    if (!appended || m_sourceCount == 0) {
+        recalculate();
+        return;
+    }
+
+    const auto previousCount = itemCount();
+    const auto partial = m_sourceCount % m_bucketSize != 0;
+
+    std::vector<qreal> values(count - m_sourceCount);
+    m_source->readValues(m_sourceCount, int(values.size()), values.data());
+    addValues(values);
+
+    const auto newCount = itemCount();
+    auto sources = series();
+    sources.prepend(this);
+    for (auto source : std::as_const(sources)) {
+        if (partial) {
+            Q_EMIT source->itemsChanged(previousCount - 1, 1);
+        }
+        if (newCount > previousCount) {
+            Q_EMIT source->itemsInserted(previousCount, newCount - previousCount);
+        }
+        Q_EMIT source->dataChanged();
+    }
+}
+
+void QuantileProxySource::addValues(const std::vector<qreal> &values)
+{
+    for (auto value : values) {
+        m_bucket.add(value);
+        m_sourceCount++;
+
+        if (m_sourceCount % m_bucketSize == 0) {
+            storeBucket(m_sourceCount / m_bucketSize - 1);
+            m_total.merge(m_bucket);
+            m_bucket.clear();
+        }
+    }
+
+    if (m_sourceCount % m_bucketSize != 0) {
+        storeBucket(m_sourceCount / m_bucketSize);
+    }
+}
+
+void QuantileProxySource::storeBucket(int bucket)
+{
+    for (int i = 0; i < m_quantiles.size(); ++i) {
+        auto &values = m_values[i];
+        values.resize(bucket + 1);
+        values[bucket] = m_bucket.quantile(m_quantiles.at(i));
+    }
+}
+
+#include "moc_QuantileProxySource.cpp"
@@ -0,0 +1,157 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef QUANTILEPROXYSOURCE_H
+#define QUANTILEPROXYSOURCE_H
+
+#include <vector>
+
+#include "ChartDataSource.h"
+#include "QuantileSketch.h"
+
+class QuantileProxySource;
+
+/**
+ * The values of one of the quantiles of a QuantileProxySource.
+ *
+ * \see QuantileProxySource::series
+ */
+class QUICKCHARTS_EXPORT QuantileSeriesSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by QuantileProxySource")
+
+public:
+    QuantileSeriesSource(QuantileProxySource *proxy, int index);
+
+    /**
+     * The quantile provided by this source.
+     */
+    Q_PROPERTY(qreal quantile READ quantile CONSTANT)
+    qreal quantile() const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    QuantileProxySource *m_proxy;
+    int m_index;
+};
+
+/**
+ * A data source that provides quantiles of groups of items of a different
+ * data source.
+ *
+ * This source divides the items of another source into consecutive buckets of
+ * \ref bucketSize items, like AggregateProxySource does. For each bucket, it
+ * provides an estimate of each of \ref quantiles, for example to show the 50th,
+ * 95th and 99th percentile of request durations over time. Each quantile is
+ * provided by a separate source in \ref series. This source itself provides the
+ * first quantile.
+ *
+ * Quantiles are estimated using a t-digest, which summarises the items of a
+ * bucket using a bounded amount of memory and is most accurate for quantiles
+ * close to 0 and 1. Adding an item takes O(log k) time for a sketch of size k,
+ * which is determined by \ref compression. When items are appended to the
+ * source, only the last bucket and any new buckets are updated.
+ */
+class QUICKCHARTS_EXPORT QuantileProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit QuantileProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The number of items of the source in each bucket.
+     *
+     * Defaults to 100.
+     */
+    Q_PROPERTY(int bucketSize READ bucketSize WRITE setBucketSize NOTIFY bucketSizeChanged)
+    int bucketSize() const;
+    void setBucketSize(int newBucketSize);
+    Q_SIGNAL void bucketSizeChanged();
+
+    /**
+     * The quantiles to provide, each between 0 and 1.
+     *
+     * Defaults to 0.5, 0.95 and 0.99.
+     */
+    Q_PROPERTY(QList<qreal> quantiles READ quantiles WRITE setQuantiles NOTIFY quantilesChanged)
+    QList<qreal> quantiles() const;
+    void setQuantiles(const QList<qreal> &newQuantiles);
+    Q_SIGNAL void quantilesChanged();
+
+    /**
+     * The accuracy of the estimates.
+     *
+     * Higher values give more accurate estimates at the cost of using more
+     * memory and time. Defaults to 100.
+     */
+    Q_PROPERTY(qreal compression READ compression WRITE setCompression NOTIFY compressionChanged)
+    qreal compression() const;
+    void setCompression(qreal newCompression);
+    Q_SIGNAL void compressionChanged();
+
+    /**
+     * A source for each of \ref quantiles, in the same order.
+     */
+    Q_PROPERTY(QList<ChartDataSource *> series READ series NOTIFY seriesChanged)
+    QList<ChartDataSource *> series() const;
+    Q_SIGNAL void seriesChanged();
+
+    /**
+     * An estimate of quantile \p q over all items of the source.
+     *
+     * This merges the estimates of all buckets.
+     */
+    Q_INVOKABLE qreal totalQuantile(qreal q) const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    friend class QuantileSeriesSource;
+
+    void updateSeries();
+    void recalculate();
+    void onSourceDataChanged();
+    void addValues(const std::vector<qreal> &values);
+    void storeBucket(int bucket);
+
+    ChartDataSource *m_source = nullptr;
+    int m_bucketSize = 100;
+    QList<qreal> m_quantiles = {0.5, 0.95, 0.99};
+    qreal m_compression = 100.0;
+    QList<QuantileSeriesSource *> m_series;
+
+    int m_sourceCount = 0;
+    // The items of the last bucket, if it is not full yet.
+    QuantileSketch m_bucket;
+    // The items of all full buckets.
+    QuantileSketch m_total;
+    // The estimates of each bucket, for each quantile.
+    std::vector<std::vector<qreal>> m_values;
+};
+
+#endif // QUANTILEPROXYSOURCE_H
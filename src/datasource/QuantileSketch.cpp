@@ -0,0 +1,168 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+
+QuantileSketch::QuantileSketch(qreal compression)
+    : m_compression(std::max(compression, 10.0))
+{
+}
+
+qreal QuantileSketch::compression() const
+{
+    return m_compression;
+}
+
+qreal QuantileSketch::count() const
+{
+    return m_count;
+}
+
+bool QuantileSketch::isEmpty() const
+{
+    return m_count <= 0.0;
+}
+
+void QuantileSketch::add(qreal value, qreal weight)
+{
+    if (weight <= 0.0) {
+        return;
+    }
+
+    if (isEmpty()) {
+        m_minimum = value;
+        m_maximum = value;
+    } else {
+        m_minimum = std::min(m_minimum, value);
+        m_maximum = std::max(m_maximum, value);
+    }
+
+    m_count += weight;
+    m_buffer.push_back(Centroid{value, weight});
+
+    if (m_buffer.size() >= std::size_t(m_compression * 5)) {
+        compress();
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+    other.compress();
+    for (const auto &centroid : other.m_centroids) {
+        add(centroid.mean, centroid.weight);
+    }
+
+    // Centroids approximate the values, so use the exact extremes.
+    if (!other.isEmpty()) {
+        m_minimum = std::min(m_minimum, other.m_minimum);
+        m_maximum = std::max(m_maximum, other.m_maximum);
+    }
+}
+
+void QuantileSketch::clear()
+{
+    m_count = 0.0;
+    m_minimum = 0.0;
+    m_maximum = 0.0;
+    m_centroids.clear();
+    m_buffer.clear();
+}
+
+qreal QuantileSketch::quantile(qreal q) const
+{
+    if (isEmpty()) {
+        return 0.0;
+    }
+
+    compress();
+
+    q = std::clamp(q, 0.0, 1.0);
+    if (m_centroids.size() == 1) {
+        return m_centroids.front().mean;
+    }
+
+    // Each centroid is considered to be centered on its mean, with half of its
+    // weight on either side. Values between centroids are interpolated, those
+    // before the first and after the last centroid are interpolated with the
+    // minimum and maximum.
+    const auto index = q * m_count;
+
+    const auto &first = m_centroids.front();
+    if (index < first.weight / 2.0) {
+        return m_minimum + (first.mean - m_minimum) * (index / (first.weight / 2.0));
+    }
+
+    auto weightSoFar = first.weight / 2.0;
+    for (std::size_t i = 0; i + 1 < m_centroids.size(); ++i) {
+        const auto &left = m_centroids[i];
+        const auto &right = m_centroids[i + 1];
+        const auto distance = (left.weight + right.weight) / 2.0;
+        if (index < weightSoFar + distance) {
+            return left.mean + (right.mean - left.mean) * ((index - weightSoFar) / distance);
+        }
+        weightSoFar += distance;
+    }
+
+    const auto &last = m_centroids.back();
+    const auto remaining = last.weight / 2.0;
+    return last.mean + (m_maximum - last.mean) * std::min((index - weightSoFar) / remaining, 1.0);
+}
+
+qreal QuantileSketch::minimum() const
+{
+    return m_minimum;
+}
+
+qreal QuantileSketch::maximum() const
+{
+    return m_maximum;
+}
+
+int QuantileSketch::centroidCount() const
+{
+    compress();
+    return m_centroids.size();
+}
+
+void QuantileSketch::compress() const
+{
+    if (m_buffer.empty()) {
+        return;
+    }
+
+    m_buffer.insert(m_buffer.end(), m_centroids.cbegin(), m_centroids.cend());
+    std::sort(m_buffer.begin(), m_buffer.end(), [](const Centroid &left, const Centroid &right) {
+        return left.mean < right.mean;
+    });
+
+    // Merge neighbouring centroids as long as the result stays below a size
+    // that depends on its position in the distribution: 4 * n * q * (1 - q)
+    // divided by the compression.
+    m_centroids.clear();
+    auto current = m_buffer.front();
+    auto weightSoFar = 0.0;
+    for (auto itr = m_buffer.cbegin() + 1; itr != m_buffer.cend(); ++itr) {
+        const auto proposed = current.weight + itr->weight;
+        const auto q0 = weightSoFar / m_count;
+        const auto q2 = (weightSoFar + proposed) / m_count;
+        const auto limit = m_count * 4.0 * std::min(q0 * (1.0 - q0), q2 * (1.0 - q2)) / m_compression;
+
+        if (proposed <= limit) {
+            current.mean += (itr->mean - current.mean) * itr->weight / proposed;
+            current.weight = proposed;
+        } else {
+            weightSoFar += current.weight;
+            m_centroids.push_back(current);
+            current = *itr;
+        }
+    }
+    m_centroids.push_back(current);
+
+    m_buffer.clear();
+}
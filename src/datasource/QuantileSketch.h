@@ -0,0 +1,80 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+
+#include <vector>
+
+#include <QtGlobal>
+
+/**
+ * An approximation of the distribution of a stream of values.
+ *
+ * This is a merging t-digest: values are summarised by centroids, each with a
+ * mean and a weight, with small centroids near both ends of the distribution
+ * and larger ones in the middle. This makes quantiles near 0 and 1 more
+ * accurate than those in the middle. The number of centroids mostly depends
+ * on the compression and grows only logarithmically with the number of
+ * values; with the default compression it stays below a thousand for millions
+ * of values.
+ *
+ * New values are collected in a buffer which is sorted and merged into the
+ * centroids once it is full, so adding a value is O(log k) amortised. Sketches
+ * can be merged, which gives the same result as adding the values of both.
+ */
+class QuantileSketch
+{
+public:
+    explicit QuantileSketch(qreal compression = 100.0);
+
+    qreal compression() const;
+
+    /**
+     * The total weight of all values added.
+     */
+    qreal count() const;
+    bool isEmpty() const;
+
+    void add(qreal value, qreal weight = 1.0);
+    void merge(const QuantileSketch &other);
+    void clear();
+
+    /**
+     * The approximate value below which a fraction \p q of the values lies.
+     *
+     * Returns 0 if the sketch is empty.
+     */
+    qreal quantile(qreal q) const;
+
+    qreal minimum() const;
+    qreal maximum() const;
+
+    /**
+     * The number of centroids, after merging any buffered values.
+     */
+    int centroidCount() const;
+
+private:
+    struct Centroid {
+        qreal mean = 0.0;
+        qreal weight = 0.0;
+    };
+
+    void compress() const;
+
+    qreal m_compression;
+    qreal m_count = 0.0;
+    qreal m_minimum = 0.0;
+    qreal m_maximum = 0.0;
+
+    // Merging is done lazily, so querying a const sketch modifies these.
+    mutable std::vector<Centroid> m_centroids;
+    mutable std::vector<Centroid> m_buffer;
+};
+
+#endif // QUANTILESKETCH_H
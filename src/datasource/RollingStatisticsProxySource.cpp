@@ -0,0 +1,421 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "RollingStatisticsProxySource.h"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+static QVariant minimumOf(const std::deque<qreal> &values)
+{
+    auto itr = std::min_element(values.cbegin(), values.cend());
+    if (itr != values.cend()) {
+        return QVariant{*itr};
+    }
+    return QVariant{};
+}
+
+static QVariant maximumOf(const std::deque<qreal> &values)
+{
+    auto itr = std::max_element(values.cbegin(), values.cend());
+    if (itr != values.cend()) {
+        return QVariant{*itr};
+    }
+    return QVariant{};
+}
+
+RollingStatisticsBandSource::RollingStatisticsBandSource(RollingStatisticsProxySource *proxy, const std::deque<qreal> &values)
+    : ChartDataSource(proxy)
+    , m_proxy(proxy)
+    , m_values(values)
+{
+}
+
+int RollingStatisticsBandSource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant RollingStatisticsBandSource::item(int index) const
+{
+    if (index < 0 || index >= int(m_values.size())) {
+        return QVariant{};
+    }
+
+    return m_values[m_proxy->timeIndex(index)];
+}
+
+QVariant RollingStatisticsBandSource::minimum() const
+{
+    return cachedMinimum([this]() {
+        return minimumOf(m_values);
+    });
+}
+
+QVariant RollingStatisticsBandSource::maximum() const
+{
+    return cachedMaximum([this]() {
+        return maximumOf(m_values);
+    });
+}
+
+void RollingStatisticsBandSource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < int(m_values.size()) ? m_values[m_proxy->timeIndex(index)] : 0.0;
+    }
+}
+
+RollingStatisticsProxySource::RollingStatisticsProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    m_upperBand = new RollingStatisticsBandSource(this, m_upper);
+    m_lowerBand = new RollingStatisticsBandSource(this, m_lower);
+
+    connect(this, &RollingStatisticsProxySource::sourceChanged, this, &RollingStatisticsProxySource::recalculate);
+    connect(this, &RollingStatisticsProxySource::windowChanged, this, &RollingStatisticsProxySource::recalculate);
+    connect(this, &RollingStatisticsProxySource::statisticChanged, this, &RollingStatisticsProxySource::recalculate);
+    connect(this, &RollingStatisticsProxySource::bandWidthChanged, this, &RollingStatisticsProxySource::recalculate);
+    connect(this, &RollingStatisticsProxySource::newestFirstChanged, this, &RollingStatisticsProxySource::recalculate);
+}
+
+ChartDataSource *RollingStatisticsProxySource::source() const
+{
+    return m_source;
+}
+
+void RollingStatisticsProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::itemsChanged, this, [this]() {
+            m_pendingReset = true;
+        });
+        connect(m_source, &ChartDataSource::itemsInserted, this, &RollingStatisticsProxySource::onSourceItemsInserted);
+        connect(m_source, &ChartDataSource::itemsRemoved, this, &RollingStatisticsProxySource::onSourceItemsRemoved);
+        connect(m_source, &ChartDataSource::dataChanged, this, &RollingStatisticsProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            recalculate();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+int RollingStatisticsProxySource::window() const
+{
+    return m_window;
+}
+
+void RollingStatisticsProxySource::setWindow(int newWindow)
+{
+    newWindow = std::max(newWindow, 1);
+    if (newWindow == m_window) {
+        return;
+    }
+
+    m_window = newWindow;
+    Q_EMIT windowChanged();
+}
+
+RollingStatisticsProxySource::Statistic RollingStatisticsProxySource::statistic() const
+{
+    return m_statistic;
+}
+
+void RollingStatisticsProxySource::setStatistic(Statistic newStatistic)
+{
+    if (newStatistic == m_statistic) {
+        return;
+    }
+
+    m_statistic = newStatistic;
+    Q_EMIT statisticChanged();
+}
+
+qreal RollingStatisticsProxySource::bandWidth() const
+{
+    return m_bandWidth;
+}
+
+void RollingStatisticsProxySource::setBandWidth(qreal newBandWidth)
+{
+    if (qFuzzyCompare(newBandWidth, m_bandWidth)) {
+        return;
+    }
+
+    m_bandWidth = newBandWidth;
+    Q_EMIT bandWidthChanged();
+}
+
+bool RollingStatisticsProxySource::newestFirst() const
+{
+    return m_newestFirst;
+}
+
+void RollingStatisticsProxySource::setNewestFirst(bool newNewestFirst)
+{
+    if (newNewestFirst == m_newestFirst) {
+        return;
+    }
+
+    m_newestFirst = newNewestFirst;
+    Q_EMIT newestFirstChanged();
+}
+
+ChartDataSource *RollingStatisticsProxySource::upperBand() const
+{
+    return m_upperBand;
+}
+
+ChartDataSource *RollingStatisticsProxySource::lowerBand() const
+{
+    return m_lowerBand;
+}
+
+int RollingStatisticsProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant RollingStatisticsProxySource::item(int index) const
+{
+    if (index < 0 || index >= int(m_values.size())) {
+        return QVariant{};
+    }
+
+    return m_values[timeIndex(index)];
+}
+
+QVariant RollingStatisticsProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        return minimumOf(m_values);
+    });
+}
+
+QVariant RollingStatisticsProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        return maximumOf(m_values);
+    });
+}
+
+void RollingStatisticsProxySource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < int(m_values.size()) ? m_values[timeIndex(index)] : 0.0;
+    }
+}
+
+void RollingStatisticsProxySource::recalculate()
+{
+    m_state = Window{};
+    m_values.clear();
+    m_upper.clear();
+    m_lower.clear();
+
+    m_sourceCount = m_source ? m_source->itemCount() : 0;
+    m_pendingInserted = 0;
+    m_pendingRemoved = 0;
+    m_pendingReset = false;
+
+    if (m_sourceCount > 0) {
+        std::vector<qreal> values(m_sourceCount);
+        m_source->readValues(0, m_sourceCount, values.data());
+        if (m_newestFirst) {
+            std::reverse(values.begin(), values.end());
+        }
+        for (auto value : values) {
+            add(value);
+        }
+    }
+
+    Q_EMIT dataChanged();
+    Q_EMIT m_upperBand->dataChanged();
+    Q_EMIT m_lowerBand->dataChanged();
+}
+
+void RollingStatisticsProxySource::add(qreal value)
+{
+    auto &state = m_state;
+    const auto window = std::size_t(m_window);
+
+    // The sums are of the difference to a value close to the mean, so the
+    // variance does not lose precision for values far away from zero.
+    if (state.count == 0) {
+        state.shift = value;
+    }
+
+    const auto shifted = value - state.shift;
+    state.values.push_back(value);
+    state.sum += shifted;
+    state.sumOfSquares += shifted * shifted;
+    if (state.values.size() > window) {
+        const auto oldest = state.values.front() - state.shift;
+        state.values.pop_front();
+        state.sum -= oldest;
+        state.sumOfSquares -= oldest * oldest;
+    }
+
+    // Updating the sums accumulates rounding errors, so calculate them again
+    // once per window.
+    if ((state.count + 1) % window == 0) {
+        state.shift = std::accumulate(state.values.cbegin(), state.values.cend(), 0.0) / state.values.size();
+        state.sum = 0.0;
+        state.sumOfSquares = 0.0;
+        for (auto windowValue : state.values) {
+            state.sum += windowValue - state.shift;
+            state.sumOfSquares += (windowValue - state.shift) * (windowValue - state.shift);
+        }
+    }
+
+    const auto smoothing = 2.0 / (window + 1);
+    state.exponentialMean = state.count == 0 ? value : state.exponentialMean + smoothing * (value - state.exponentialMean);
+
+    while (!state.minimum.empty() && state.minimum.back().second >= value) {
+        state.minimum.pop_back();
+    }
+    state.minimum.emplace_back(state.count, value);
+    if (state.minimum.front().first + window <= state.count) {
+        state.minimum.pop_front();
+    }
+
+    while (!state.maximum.empty() && state.maximum.back().second <= value) {
+        state.maximum.pop_back();
+    }
+    state.maximum.emplace_back(state.count, value);
+    if (state.maximum.front().first + window <= state.count) {
+        state.maximum.pop_front();
+    }
+
+    state.count++;
+
+    const auto count = qreal(state.values.size());
+    const auto meanShifted = state.sum / count;
+    const auto mean = meanShifted + state.shift;
+    const auto deviation = std::sqrt(std::max(state.sumOfSquares / count - meanShifted * meanShifted, 0.0));
+
+    switch (m_statistic) {
+    case Mean:
+        m_values.push_back(mean);
+        break;
+    case ExponentialMean:
+        m_values.push_back(state.exponentialMean);
+        break;
+    case StandardDeviation:
+        m_values.push_back(deviation);
+        break;
+    case Minimum:
+        m_values.push_back(state.minimum.front().second);
+        break;
+    case Maximum:
+        m_values.push_back(state.maximum.front().second);
+        break;
+    }
+
+    m_upper.push_back(mean + m_bandWidth * deviation);
+    m_lower.push_back(mean - m_bandWidth * deviation);
+}
+
+int RollingStatisticsProxySource::timeIndex(int index) const
+{
+    return m_newestFirst ? int(m_values.size()) - 1 - index : index;
+}
+
+void RollingStatisticsProxySource::onSourceItemsInserted(int start, int count)
+{
+    const auto atNewestEnd = m_newestFirst ? start == 0 : start == m_sourceCount;
+    if (!atNewestEnd) {
+        m_pendingReset = true;
+    }
+
+    m_pendingInserted += count;
+    m_sourceCount += count;
+}
+
+void RollingStatisticsProxySource::onSourceItemsRemoved(int start, int count)
+{
+    const auto atOldestEnd = m_newestFirst ? start + count == m_sourceCount : start == 0;
+    if (!atOldestEnd) {
+        m_pendingReset = true;
+    }
+
+    m_pendingRemoved += count;
+    m_sourceCount -= count;
+}
+
+void RollingStatisticsProxySource::onSourceDataChanged()
+{
+    const auto inserted = m_pendingInserted;
+    const auto removed = m_pendingRemoved;
+    const auto count = m_source->itemCount();
+
+    // Anything other than adding new items and removing old ones requires
+    // calculating everything again.
+    if (m_pendingReset || (inserted == 0 && removed == 0) || removed > int(m_values.size()) || m_sourceCount != count) {
+        recalculate();
+        return;
+    }
+
+    m_pendingInserted = 0;
+    m_pendingRemoved = 0;
+
+    std::vector<qreal> values(inserted);
+    if (inserted > 0) {
+        m_source->readValues(m_newestFirst ? 0 : count - inserted, inserted, values.data());
+        if (m_newestFirst) {
+            std::reverse(values.begin(), values.end());
+        }
+    }
+
+    for (auto results : {&m_values, &m_upper, &m_lower}) {
+        results->erase(results->begin(), results->begin() + removed);
+    }
+
+    for (auto value : values) {
+        add(value);
+    }
+
+    emitChanges(inserted, removed);
+}
+
+void RollingStatisticsProxySource::emitChanges(int inserted, int removed)
+{
+    const auto count = int(m_values.size());
+    for (ChartDataSource *source : {static_cast<ChartDataSource *>(this), static_cast<ChartDataSource *>(m_upperBand), static_cast<ChartDataSource *>(m_lowerBand)}) {
+        if (m_newestFirst) {
+            if (inserted > 0) {
+                Q_EMIT source->itemsInserted(0, inserted);
+            }
+            if (removed > 0) {
+                Q_EMIT source->itemsRemoved(count, removed);
+            }
+        } else {
+            if (removed > 0) {
+                Q_EMIT source->itemsRemoved(0, removed);
+            }
+            if (inserted > 0) {
+                Q_EMIT source->itemsInserted(count - inserted, inserted);
+            }
+        }
+        Q_EMIT source->dataChanged();
+    }
+}
+
+#include "moc_RollingStatisticsProxySource.cpp"
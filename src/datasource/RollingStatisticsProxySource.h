@@ -0,0 +1,197 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef ROLLINGSTATISTICSPROXYSOURCE_H
+#define ROLLINGSTATISTICSPROXYSOURCE_H
+
+#include <deque>
+
+#include "ChartDataSource.h"
+
+class RollingStatisticsProxySource;
+
+/**
+ * One of the bands of a RollingStatisticsProxySource.
+ *
+ * \see RollingStatisticsProxySource::upperBand
+ * \see RollingStatisticsProxySource::lowerBand
+ */
+class QUICKCHARTS_EXPORT RollingStatisticsBandSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by RollingStatisticsProxySource")
+
+public:
+    RollingStatisticsBandSource(RollingStatisticsProxySource *proxy, const std::deque<qreal> &values);
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    RollingStatisticsProxySource *m_proxy;
+    const std::deque<qreal> &m_values;
+};
+
+/**
+ * A data source that calculates statistics over a moving window of a
+ * different data source.
+ *
+ * For each item of the source, this calculates \ref statistic over that item
+ * and the \ref window - 1 items before it. In addition, \ref upperBand and
+ * \ref lowerBand provide the mean plus and minus \ref bandWidth times the
+ * standard deviation, which can for example be drawn as an area around the
+ * mean.
+ *
+ * When items are added to the newest end of the source, or removed from its
+ * oldest end, only the new items are calculated, taking constant time per
+ * item. Removing items from the oldest end does not change the statistics of
+ * the remaining items. Any other change recalculates all items.
+ */
+class QUICKCHARTS_EXPORT RollingStatisticsProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * The statistic provided by this source.
+     */
+    enum Statistic {
+        Mean, ///< The average of the window.
+        /**
+         * An exponentially weighted moving average, using a smoothing factor
+         * of 2 / (\ref window + 1).
+         */
+        ExponentialMean,
+        StandardDeviation, ///< The standard deviation of the window.
+        Minimum, ///< The smallest item of the window.
+        Maximum, ///< The largest item of the window.
+    };
+    Q_ENUM(Statistic)
+
+    explicit RollingStatisticsProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The number of items the statistics are calculated over.
+     *
+     * Items at the start of the source use fewer items. Defaults to 10.
+     */
+    Q_PROPERTY(int window READ window WRITE setWindow NOTIFY windowChanged)
+    int window() const;
+    void setWindow(int newWindow);
+    Q_SIGNAL void windowChanged();
+
+    /**
+     * The statistic provided by this source.
+     *
+     * Defaults to Mean.
+     */
+    Q_PROPERTY(Statistic statistic READ statistic WRITE setStatistic NOTIFY statisticChanged)
+    Statistic statistic() const;
+    void setStatistic(Statistic newStatistic);
+    Q_SIGNAL void statisticChanged();
+
+    /**
+     * The number of standard deviations between the mean and each band.
+     *
+     * Defaults to 2.
+     */
+    Q_PROPERTY(qreal bandWidth READ bandWidth WRITE setBandWidth NOTIFY bandWidthChanged)
+    qreal bandWidth() const;
+    void setBandWidth(qreal newBandWidth);
+    Q_SIGNAL void bandWidthChanged();
+
+    /**
+     * Whether the newest item of the source is its first item.
+     *
+     * This should be set when using a source like HistoryProxySource. The
+     * window then consists of an item and the items after it. Defaults to
+     * false.
+     */
+    Q_PROPERTY(bool newestFirst READ newestFirst WRITE setNewestFirst NOTIFY newestFirstChanged)
+    bool newestFirst() const;
+    void setNewestFirst(bool newNewestFirst);
+    Q_SIGNAL void newestFirstChanged();
+
+    /**
+     * A source providing the mean plus \ref bandWidth standard deviations.
+     */
+    Q_PROPERTY(ChartDataSource *upperBand READ upperBand CONSTANT)
+    ChartDataSource *upperBand() const;
+
+    /**
+     * A source providing the mean minus \ref bandWidth standard deviations.
+     */
+    Q_PROPERTY(ChartDataSource *lowerBand READ lowerBand CONSTANT)
+    ChartDataSource *lowerBand() const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    friend class RollingStatisticsBandSource;
+
+    // The state of the window after the most recent item.
+    struct Window {
+        std::deque<qreal> values;
+        qreal shift = 0.0;
+        qreal sum = 0.0;
+        qreal sumOfSquares = 0.0;
+        qreal exponentialMean = 0.0;
+        quint64 count = 0;
+        // Indices and values of candidates for the minimum and maximum.
+        std::deque<std::pair<quint64, qreal>> minimum;
+        std::deque<std::pair<quint64, qreal>> maximum;
+    };
+
+    void recalculate();
+    void add(qreal value);
+    int timeIndex(int index) const;
+    void onSourceItemsInserted(int start, int count);
+    void onSourceItemsRemoved(int start, int count);
+    void onSourceDataChanged();
+    void emitChanges(int inserted, int removed);
+
+    ChartDataSource *m_source = nullptr;
+    int m_window = 10;
+    Statistic m_statistic = Mean;
+    qreal m_bandWidth = 2.0;
+    bool m_newestFirst = false;
+
+    Window m_state;
+
+    // Results for each item of the source, ordered from oldest to newest.
+    std::deque<qreal> m_values;
+    std::deque<qreal> m_upper;
+    std::deque<qreal> m_lower;
+
+    // Changes of the source since its last dataChanged().
+    int m_sourceCount = 0;
+    int m_pendingInserted = 0;
+    int m_pendingRemoved = 0;
+    bool m_pendingReset = false;
+
+    RollingStatisticsBandSource *m_upperBand = nullptr;
+    RollingStatisticsBandSource *m_lowerBand = nullptr;
+};
+
+#endif // ROLLINGSTATISTICSPROXYSOURCE_H
@@ -0,0 +1,269 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "SeriesStore.h"
+
+#include <algorithm>
+
+#include "charts_datasource_logging.h"
+
+SeriesStoreSource::SeriesStoreSource(SeriesStore *store, int index)
+    : ChartDataSource(store)
+    , m_store(store)
+    , m_index(index)
+{
+}
+
+SeriesStore *SeriesStoreSource::store() const
+{
+    return m_store;
+}
+
+int SeriesStoreSource::index() const
+{
+    return m_index;
+}
+
+const qreal *SeriesStoreSource::data() const
+{
+    return m_store->column(m_index);
+}
+
+int SeriesStoreSource::itemCount() const
+{
+    return m_store->itemCount();
+}
+
+QVariant SeriesStoreSource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    return data()[index];
+}
+
+QVariant SeriesStoreSource::minimum() const
+{
+    return cachedMinimum([this]() {
+        const auto values = data();
+        auto itr = std::min_element(values, values + itemCount());
+        if (itr != values + itemCount()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant SeriesStoreSource::maximum() const
+{
+    return cachedMaximum([this]() {
+        const auto values = data();
+        auto itr = std::max_element(values, values + itemCount());
+        if (itr != values + itemCount()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void SeriesStoreSource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, itemCount());
+    if (first < last) {
+        std::copy(data() + first, data() + last, output + (first - start));
+    }
+}
+
+SeriesStore::SeriesStore(QObject *parent)
+    : QObject(parent)
+{
+    setSeriesCount(1);
+}
+
+int SeriesStore::seriesCount() const
+{
+    return m_columns.size();
+}
+
+void SeriesStore::setSeriesCount(int newSeriesCount)
+{
+    newSeriesCount = std::max(newSeriesCount, 0);
+    if (newSeriesCount == int(m_columns.size())) {
+        return;
+    }
+
+    // Series that remain keep their source, so charts using them are
+    // unaffected.
+    while (m_series.size() > newSeriesCount) {
+        delete m_series.takeLast();
+    }
+    m_columns.resize(newSeriesCount, std::vector<qreal>(m_itemCount, 0.0));
+    while (m_series.size() < newSeriesCount) {
+        m_series.append(new SeriesStoreSource(this, int(m_series.size())));
+    }
+
+    Q_EMIT seriesCountChanged();
+}
+
+QList<ChartDataSource *> SeriesStore::series() const
+{
+    return m_series;
+}
+
+int SeriesStore::itemCount() const
+{
+    return m_itemCount;
+}
+
+void SeriesStore::appendRow(const QList<qreal> &values)
+{
+    if (values.size() > qsizetype(m_columns.size())) {
+        qCWarning(DATASOURCE) << "SeriesStore: Ignoring values for" << values.size() - m_columns.size() << "series that do not exist";
+    }
+
+    for (std::size_t series = 0; series < m_columns.size(); ++series) {
+        m_columns[series].push_back(qsizetype(series) < values.size() ? values.at(series) : 0.0);
+    }
+
+    addChange(m_itemCount, m_itemCount + 1);
+    m_itemCount++;
+    announce();
+}
+
+void SeriesStore::appendRows(std::span<const qreal> values)
+{
+    if (m_columns.empty()) {
+        return;
+    }
+
+    const auto stride = m_columns.size();
+    const auto rows = values.size() / stride;
+    if (values.size() % stride != 0) {
+        qCWarning(DATASOURCE) << "SeriesStore: Ignoring incomplete row of" << values.size() % stride << "values";
+    }
+    if (rows == 0) {
+        return;
+    }
+
+    // Transpose the rows into the columns, one column at a time so each
+    // column is written sequentially.
+    for (std::size_t series = 0; series < stride; ++series) {
+        auto &column = m_columns[series];
+        column.reserve(column.size() + rows);
+        for (std::size_t row = 0; row < rows; ++row) {
+            column.push_back(values[row * stride + series]);
+        }
+    }
+
+    addChange(m_itemCount, m_itemCount + int(rows));
+    m_itemCount += int(rows);
+    announce();
+}
+
+void SeriesStore::setValue(int series, int index, qreal value)
+{
+    if (series < 0 || series >= int(m_columns.size()) || index < 0 || index >= m_itemCount) {
+        qCWarning(DATASOURCE) << "SeriesStore: Invalid series" << series << "or index" << index;
+        return;
+    }
+
+    m_columns[series][index] = value;
+    addChange(index, index + 1);
+    announce();
+}
+
+void SeriesStore::clear()
+{
+    if (m_itemCount == 0) {
+        return;
+    }
+
+    for (auto &column : m_columns) {
+        column.clear();
+    }
+    m_itemCount = 0;
+
+    if (!m_hasPendingChange) {
+        m_previousItemCount = 0;
+    }
+    m_hasPendingChange = true;
+    m_pendingReset = true;
+    announce();
+}
+
+void SeriesStore::beginBatch()
+{
+    m_batchDepth++;
+}
+
+void SeriesStore::endBatch()
+{
+    if (m_batchDepth == 0) {
+        qCWarning(DATASOURCE) << "SeriesStore: endBatch() called without beginBatch()";
+        return;
+    }
+
+    m_batchDepth--;
+    announce();
+}
+
+const qreal *SeriesStore::column(int series) const
+{
+    if (series < 0 || series >= int(m_columns.size())) {
+        return nullptr;
+    }
+
+    return m_columns[series].data();
+}
+
+void SeriesStore::addChange(int start, int end)
+{
+    if (m_hasPendingChange) {
+        m_pendingStart = std::min(m_pendingStart, start);
+        m_pendingEnd = std::max(m_pendingEnd, end);
+    } else {
+        m_hasPendingChange = true;
+        m_pendingStart = start;
+        m_pendingEnd = end;
+        m_previousItemCount = m_itemCount;
+    }
+}
+
+void SeriesStore::announce()
+{
+    if (m_batchDepth > 0 || !m_hasPendingChange) {
+        return;
+    }
+
+    m_hasPendingChange = false;
+
+    // Values are only ever appended or changed in place, so everything past
+    // the previous item count is new.
+    const auto changedEnd = std::min(m_pendingEnd, m_previousItemCount);
+    const auto inserted = m_itemCount - m_previousItemCount;
+
+    for (auto series : std::as_const(m_series)) {
+        if (!m_pendingReset) {
+            if (changedEnd > m_pendingStart) {
+                Q_EMIT series->itemsChanged(m_pendingStart, changedEnd - m_pendingStart);
+            }
+            if (inserted > 0) {
+                Q_EMIT series->itemsInserted(m_previousItemCount, inserted);
+            }
+        }
+        Q_EMIT series->dataChanged();
+    }
+
+    m_pendingReset = false;
+    Q_EMIT changed();
+}
+
+#include "moc_SeriesStore.cpp"
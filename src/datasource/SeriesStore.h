@@ -0,0 +1,191 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef SERIESSTORE_H
+#define SERIESSTORE_H
+
+#include <span>
+#include <vector>
+
+#include <QObject>
+#include <qqmlregistration.h>
+
+#include "ChartDataSource.h"
+
+#include "quickcharts_export.h"
+
+class SeriesStore;
+
+/**
+ * A single series of a SeriesStore.
+ *
+ * \see SeriesStore::series
+ */
+class QUICKCHARTS_EXPORT SeriesStoreSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by SeriesStore")
+
+public:
+    SeriesStoreSource(SeriesStore *store, int index);
+
+    /**
+     * The store this series is part of.
+     */
+    Q_PROPERTY(SeriesStore *store READ store CONSTANT)
+    SeriesStore *store() const;
+
+    /**
+     * The index of this series in the store.
+     */
+    Q_PROPERTY(int index READ index CONSTANT)
+    int index() const;
+
+    /**
+     * The values of this series, itemCount() values in contiguous memory.
+     *
+     * Only valid until the store is changed.
+     */
+    const qreal *data() const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    SeriesStore *m_store;
+    int m_index;
+};
+
+/**
+ * A store for several series of values that share the same items.
+ *
+ * This is intended for data where each item has a value for several series,
+ * like the samples of a set of sensors taken at the same time. Each series is
+ * stored contiguously, and \ref series provides a data source for each of
+ * them, which can be used by any number of charts.
+ *
+ * All series always have the same number of items. Changes are made a row,
+ * that is one value for each series, at a time. Changes made between
+ * beginBatch() and endBatch() are combined into a single change for all
+ * series, so charts only update once, no matter how many series they display.
+ * Charts that display several series of the same store also read the values
+ * directly from the store rather than copying them.
+ *
+ * \code{.qml}
+ * SeriesStore {
+ *     id: store
+ *     seriesCount: 3
+ * }
+ *
+ * BarChart {
+ *     valueSources: store.series
+ *     stacked: true
+ * }
+ * \endcode
+ */
+class QUICKCHARTS_EXPORT SeriesStore : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit SeriesStore(QObject *parent = nullptr);
+
+    /**
+     * The number of series in the store.
+     *
+     * Adding series fills them with zeros, removing series discards their
+     * values. Defaults to 1.
+     */
+    Q_PROPERTY(int seriesCount READ seriesCount WRITE setSeriesCount NOTIFY seriesCountChanged)
+    int seriesCount() const;
+    void setSeriesCount(int newSeriesCount);
+    Q_SIGNAL void seriesCountChanged();
+
+    /**
+     * A data source for each series.
+     */
+    Q_PROPERTY(QList<ChartDataSource *> series READ series NOTIFY seriesCountChanged)
+    QList<ChartDataSource *> series() const;
+
+    /**
+     * The number of items in each series.
+     */
+    Q_PROPERTY(int itemCount READ itemCount NOTIFY changed)
+    int itemCount() const;
+
+    /**
+     * Add a row of values, one for each series.
+     *
+     * Missing values are set to 0.
+     */
+    Q_INVOKABLE void appendRow(const QList<qreal> &values);
+    /**
+     * Add several rows of values.
+     *
+     * \p values contains one value for each series for every row, so its size
+     * should be a multiple of \ref seriesCount.
+     */
+    void appendRows(std::span<const qreal> values);
+    /**
+     * Change a single value of a series.
+     */
+    Q_INVOKABLE void setValue(int series, int index, qreal value);
+    /**
+     * Remove all items.
+     */
+    Q_INVOKABLE void clear();
+
+    /**
+     * Start combining changes.
+     *
+     * Changes are only announced once a matching endBatch() is called. Batches
+     * can be nested, in which case changes are announced when the outermost
+     * batch ends.
+     */
+    Q_INVOKABLE void beginBatch();
+    /**
+     * Announce all changes since beginBatch().
+     */
+    Q_INVOKABLE void endBatch();
+
+    /**
+     * The values of a series in contiguous memory, or nullptr if it does not
+     * exist.
+     *
+     * Only valid until the store is changed.
+     */
+    const qreal *column(int series) const;
+
+    /**
+     * Emitted once for every batch of changes, after all series have emitted
+     * ChartDataSource::dataChanged().
+     */
+    Q_SIGNAL void changed();
+
+private:
+    void addChange(int start, int end);
+    void announce();
+
+    std::vector<std::vector<qreal>> m_columns;
+    int m_itemCount = 0;
+    QList<ChartDataSource *> m_series;
+
+    int m_batchDepth = 0;
+    bool m_hasPendingChange = false;
+    bool m_pendingReset = false;
+    int m_pendingStart = 0;
+    int m_pendingEnd = 0;
+    // Item count at the start of the batch.
+    int m_previousItemCount = 0;
+};
+
+#endif // SERIESSTORE_H
@@ -0,0 +1,236 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "SharedMemorySource.h"
+
+#include <atomic>
+#include <cstring>
+
+#include <QSharedMemory>
+
+#include "charts_datasource_logging.h"
+
+SharedMemorySource::SharedMemorySource(QObject *parent)
+    : HistorySource(parent)
+{
+    // The writer may not have created the segment yet.
+    m_attachTimer.setInterval(1000);
+    connect(&m_attachTimer, &QTimer::timeout, this, &SharedMemorySource::attach);
+
+    // Read new values once per frame.
+    m_pollTimer.setInterval(16);
+    connect(&m_pollTimer, &QTimer::timeout, this, &SharedMemorySource::poll);
+
+    connect(this, &SharedMemorySource::nameChanged, this, &SharedMemorySource::queueAttach);
+}
+
+SharedMemorySource::~SharedMemorySource() = default;
+
+QNativeIpcKey SharedMemorySource::nativeKey(const QString &name)
+{
+    if (!QSharedMemory::isKeyTypeSupported(QNativeIpcKey::Type::PosixRealtime)) {
+        return QNativeIpcKey(name);
+    }
+
+    return QNativeIpcKey(name.startsWith(QLatin1Char('/')) ? name : QLatin1Char('/') + name, QNativeIpcKey::Type::PosixRealtime);
+}
+
+QString SharedMemorySource::name() const
+{
+    return m_name;
+}
+
+void SharedMemorySource::setName(const QString &newName)
+{
+    if (newName == m_name) {
+        return;
+    }
+
+    m_name = newName;
+    Q_EMIT nameChanged();
+}
+
+SharedMemorySource::Status SharedMemorySource::status() const
+{
+    return m_status;
+}
+
+QString SharedMemorySource::errorString() const
+{
+    return m_errorString;
+}
+
+void SharedMemorySource::queueAttach()
+{
+    if (!m_attachQueued) {
+        m_attachQueued = true;
+        QMetaObject::invokeMethod(this, &SharedMemorySource::attach, Qt::QueuedConnection);
+    }
+}
+
+void SharedMemorySource::attach()
+{
+    m_attachQueued = false;
+
+    detach();
+    m_errorString.clear();
+
+    if (m_name.isEmpty()) {
+        m_attachTimer.stop();
+        setStatus(Null);
+        return;
+    }
+
+    auto memory = std::make_unique<QSharedMemory>(nativeKey(m_name));
+    // The segment is never written to, see writeCount().
+    if (!memory->attach(QSharedMemory::ReadWrite)) {
+        if (memory->error() == QSharedMemory::NotFound) {
+            m_attachTimer.start();
+            setStatus(Waiting);
+        } else {
+            setError(memory->errorString());
+        }
+        return;
+    }
+
+    const auto data = static_cast<const uchar *>(memory->constData());
+    const auto size = quint64(memory->size());
+
+    // The writer may still be setting up the segment. It writes the magic
+    // last, so once that is valid, so is the rest of the header.
+    if (size < sizeof(Header)
+        || std::atomic_ref<quint32>(static_cast<Header *>(memory->data())->magic).load(std::memory_order_acquire) != Magic) {
+        m_attachTimer.start();
+        setStatus(Waiting);
+        return;
+    }
+
+    m_attachTimer.stop();
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+
+    if (header.version != Version) {
+        setError(QStringLiteral("Unsupported header version"));
+        return;
+    }
+
+    if (header.valueType > Float64) {
+        setError(QStringLiteral("Unsupported value type"));
+        return;
+    }
+
+    if (header.capacity == 0) {
+        m_attachTimer.start();
+        setStatus(Waiting);
+        return;
+    }
+
+    const auto valueSize = header.valueType == Float32 ? sizeof(float) : sizeof(double);
+    if ((size - sizeof(Header)) / valueSize < header.capacity) {
+        setError(QStringLiteral("Segment is smaller than described by its header"));
+        return;
+    }
+
+    m_memory = std::move(memory);
+    m_values = data + sizeof(Header);
+    m_capacity = header.capacity;
+    m_valueType = ValueType(header.valueType);
+
+    // Include the values that are still in the ring buffer.
+    const auto written = writeCount();
+    m_readCount = written - std::min(written, m_capacity);
+
+    m_pollTimer.start();
+    setStatus(Attached);
+    poll();
+}
+
+void SharedMemorySource::detach()
+{
+    m_pollTimer.stop();
+    m_memory.reset();
+    m_values = nullptr;
+    m_capacity = 0;
+    m_readCount = 0;
+}
+
+void SharedMemorySource::poll()
+{
+    if (!m_memory) {
+        return;
+    }
+
+    const auto written = writeCount();
+    if (written < m_readCount) {
+        // The writer has started over.
+        m_readCount = 0;
+    }
+
+    if (written == m_readCount) {
+        return;
+    }
+
+    // Only read values that can still be in the ring buffer and that will be
+    // part of the history.
+    auto first = std::max(m_readCount, written - std::min(written, m_capacity));
+    if (maximumHistory() > 0) {
+        first = std::max(first, written - std::min(written, quint64(maximumHistory())));
+    }
+    m_readCount = written;
+
+    std::vector<qreal> values(written - first);
+    for (auto i = first; i < written; ++i) {
+        const auto data = m_values + (i % m_capacity) * (m_valueType == Float32 ? sizeof(float) : sizeof(double));
+        if (m_valueType == Float32) {
+            float value;
+            std::memcpy(&value, data, sizeof(float));
+            values[i - first] = value;
+        } else {
+            std::memcpy(&values[i - first], data, sizeof(double));
+        }
+    }
+
+    // The writer may have overwritten some of the values while copying. It
+    // may be writing value number writeCount() at this point, which replaces
+    // the value capacity positions before it.
+    const auto current = writeCount();
+    const auto valid = current + 1 - std::min(current + 1, m_capacity);
+    const auto discarded = valid > first ? std::min(valid - first, quint64(values.size())) : 0;
+
+    appendValues(values.data() + discarded, int(values.size() - discarded));
+}
+
+quint64 SharedMemorySource::writeCount() const
+{
+    // Depending on the target, an atomic 64-bit load can be implemented using
+    // instructions that store the loaded value again, like cmpxchg8b or an
+    // ldrexd/strexd loop. That is why the segment is attached read-write,
+    // even though its contents are never changed.
+    auto header = static_cast<Header *>(m_memory->data());
+    return std::atomic_ref<quint64>(header->writeCount).load(std::memory_order_acquire);
+}
+
+void SharedMemorySource::setError(const QString &errorString)
+{
+    qCWarning(DATASOURCE) << "SharedMemorySource: Could not attach to" << m_name << errorString;
+    detach();
+    m_errorString = errorString;
+    setStatus(Error);
+}
+
+void SharedMemorySource::setStatus(Status newStatus)
+{
+    if (newStatus == m_status) {
+        return;
+    }
+
+    m_status = newStatus;
+    Q_EMIT statusChanged();
+}
+
+#include "moc_SharedMemorySource.cpp"
@@ -0,0 +1,159 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef SHAREDMEMORYSOURCE_H
+#define SHAREDMEMORYSOURCE_H
+
+#include <array>
+#include <bit>
+#include <memory>
+
+#include <QNativeIpcKey>
+#include <QTimer>
+
+#include "HistorySource.h"
+
+class QSharedMemory;
+
+/**
+ * A data source that reads values from a ring buffer in shared memory.
+ *
+ * This allows a separate process to provide values to any number of other
+ * processes without serializing them. The writing process creates a shared
+ * memory segment with the name \ref name, which on Unix systems is a POSIX
+ * shared memory object. The segment starts with a 64 byte header, followed by
+ * the ring buffer. All fields use the native byte order:
+ *
+ * | Offset | Size | Description                                               |
+ * |--------|------|-----------------------------------------------------------|
+ * | 0      | 4    | The characters "KQSM", see below.                         |
+ * | 4      | 4    | Version, must be 1.                                       |
+ * | 8      | 4    | Value type, 0 for 32-bit and 1 for 64-bit floats.         |
+ * | 12     | 4    | Capacity, the number of values in the ring buffer.        |
+ * | 16     | 8    | Write count, the total number of values written.          |
+ * | 24     | 40   | Reserved, should be 0.                                    |
+ * | 64     |      | Capacity values of the given type.                        |
+ *
+ * The writer fills in the header before writing the magic characters, which
+ * it stores atomically with release semantics. Until then they are 0 and
+ * readers keep waiting for the segment, so it can be attached to at any point
+ * while the writer is starting.
+ *
+ * There should be a single writer, which writes value number n to position
+ * n modulo capacity and then atomically stores n + 1 as write count, with
+ * release semantics. Readers read the write count with acquire semantics,
+ * copy the new values and discard those that may have been overwritten while
+ * copying them, so neither side ever waits for the other. Readers attach to
+ * the segment read-write, since on some targets an atomic load of the write
+ * count stores the loaded value again, but they never change its contents.
+ *
+ * New values are read once per frame. Values are stored like
+ * \ref HistoryProxySource does, with the most recent value as item 0 and at
+ * most \ref maximumHistory values. When attaching, the values that are
+ * already in the ring buffer are read as well.
+ *
+ * \see SharedMemoryWriter
+ */
+class QUICKCHARTS_EXPORT SharedMemorySource : public HistorySource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * The type of the values in the ring buffer.
+     */
+    enum ValueType {
+        Float32, ///< 32-bit floating point numbers.
+        Float64, ///< 64-bit floating point numbers.
+    };
+    Q_ENUM(ValueType)
+
+    /**
+     * The different states of the source.
+     */
+    enum Status {
+        Null, ///< No name has been set.
+        Waiting, ///< The segment does not exist or is not ready yet, attaching is retried regularly.
+        Attached, ///< Values are being read from the segment.
+        Error, ///< The segment is not valid, see \ref errorString.
+    };
+    Q_ENUM(Status)
+
+    /**
+     * The layout of the header at the start of the segment.
+     */
+    struct Header {
+        quint32 magic;
+        quint32 version;
+        quint32 valueType;
+        quint32 capacity;
+        quint64 writeCount;
+        char reserved[40];
+    };
+    static_assert(sizeof(Header) == 64);
+
+    static constexpr quint32 Magic = std::bit_cast<quint32>(std::array<char, 4>{'K', 'Q', 'S', 'M'});
+    static constexpr quint32 Version = 1;
+
+    /**
+     * The key used to access the segment called \p name.
+     *
+     * Where supported this is a POSIX shared memory object, named \p name with
+     * a leading slash added if needed.
+     */
+    static QNativeIpcKey nativeKey(const QString &name);
+
+    explicit SharedMemorySource(QObject *parent = nullptr);
+    ~SharedMemorySource() override;
+
+    /**
+     * The name of the shared memory segment to read from.
+     */
+    Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
+    QString name() const;
+    void setName(const QString &newName);
+    Q_SIGNAL void nameChanged();
+
+    /**
+     * The current status of the source.
+     */
+    Q_PROPERTY(Status status READ status NOTIFY statusChanged)
+    Status status() const;
+    Q_SIGNAL void statusChanged();
+
+    /**
+     * A description of the error if \ref status is Error.
+     */
+    Q_PROPERTY(QString errorString READ errorString NOTIFY statusChanged)
+    QString errorString() const;
+
+private:
+    void queueAttach();
+    void attach();
+    void detach();
+    void poll();
+    quint64 writeCount() const;
+    void setError(const QString &errorString);
+    void setStatus(Status newStatus);
+
+    QString m_name;
+    Status m_status = Null;
+    QString m_errorString;
+
+    std::unique_ptr<QSharedMemory> m_memory;
+    const uchar *m_values = nullptr;
+    quint64 m_capacity = 0;
+    ValueType m_valueType = Float64;
+    quint64 m_readCount = 0;
+    bool m_attachQueued = false;
+
+    QTimer m_attachTimer;
+    QTimer m_pollTimer;
+};
+
+#endif // SHAREDMEMORYSOURCE_H
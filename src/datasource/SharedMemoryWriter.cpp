@@ -0,0 +1,88 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "SharedMemoryWriter.h"
+
+#include <atomic>
+#include <cstring>
+
+#include <QSharedMemory>
+
+SharedMemoryWriter::SharedMemoryWriter() = default;
+
+SharedMemoryWriter::~SharedMemoryWriter() = default;
+
+bool SharedMemoryWriter::create(const QString &name, int capacity, SharedMemorySource::ValueType valueType)
+{
+    m_memory.reset();
+    m_header = nullptr;
+    m_values = nullptr;
+    m_writeCount = 0;
+    m_errorString.clear();
+
+    if (capacity <= 0) {
+        m_errorString = QStringLiteral("Capacity should be larger than 0");
+        return false;
+    }
+
+    const auto valueSize = valueType == SharedMemorySource::Float32 ? sizeof(float) : sizeof(double);
+
+    auto memory = std::make_unique<QSharedMemory>(SharedMemorySource::nativeKey(name));
+    if (!memory->create(qsizetype(sizeof(SharedMemorySource::Header) + capacity * valueSize))) {
+        m_errorString = memory->errorString();
+        return false;
+    }
+
+    // Readers may attach as soon as the segment exists, so the magic is only
+    // written once the rest of the header is valid.
+    auto header = static_cast<SharedMemorySource::Header *>(memory->data());
+    std::memset(header, 0, sizeof(SharedMemorySource::Header));
+    header->version = SharedMemorySource::Version;
+    header->valueType = valueType;
+    header->capacity = capacity;
+    std::atomic_ref<quint32>(header->magic).store(SharedMemorySource::Magic, std::memory_order_release);
+
+    m_memory = std::move(memory);
+    m_header = header;
+    m_values = static_cast<uchar *>(m_memory->data()) + sizeof(SharedMemorySource::Header);
+    m_valueType = valueType;
+    return true;
+}
+
+bool SharedMemoryWriter::isValid() const
+{
+    return m_header != nullptr;
+}
+
+QString SharedMemoryWriter::errorString() const
+{
+    return m_errorString;
+}
+
+void SharedMemoryWriter::write(std::span<const qreal> values)
+{
+    if (!m_header) {
+        return;
+    }
+
+    std::atomic_ref<quint64> writeCount(m_header->writeCount);
+    for (auto value : values) {
+        const auto index = m_writeCount % m_header->capacity;
+        if (m_valueType == SharedMemorySource::Float32) {
+            const auto converted = float(value);
+            std::memcpy(m_values + index * sizeof(float), &converted, sizeof(float));
+        } else {
+            std::memcpy(m_values + index * sizeof(double), &value, sizeof(double));
+        }
+        writeCount.store(++m_writeCount, std::memory_order_release);
+    }
+}
+
+void SharedMemoryWriter::write(qreal value)
+{
+    write(std::span<const qreal>(&value, 1));
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef SHAREDMEMORYWRITER_H
+#define SHAREDMEMORYWRITER_H
+
+#include <memory>
+#include <span>
+
+#include "SharedMemorySource.h"
+
+/**
+ * Writes values to a shared memory segment read by SharedMemorySource.
+ *
+ * This creates the segment and writes values into its ring buffer following
+ * the layout described by SharedMemorySource. The segment is removed when the
+ * writer is destroyed. Only a single writer should exist for a segment.
+ */
+class QUICKCHARTS_EXPORT SharedMemoryWriter
+{
+public:
+    SharedMemoryWriter();
+    ~SharedMemoryWriter();
+
+    SharedMemoryWriter(const SharedMemoryWriter &) = delete;
+    SharedMemoryWriter &operator=(const SharedMemoryWriter &) = delete;
+
+    /**
+     * Create the segment called \p name with room for \p capacity values.
+     *
+     * \return Whether the segment was created. If not, errorString() describes
+     *         why.
+     */
+    bool create(const QString &name, int capacity, SharedMemorySource::ValueType valueType = SharedMemorySource::Float64);
+
+    /**
+     * Whether a segment has been created.
+     */
+    bool isValid() const;
+
+    /**
+     * A description of the error if create() failed.
+     */
+    QString errorString() const;
+
+    /**
+     * Write \p values, ordered from oldest to newest.
+     *
+     * Each value is made visible to readers as soon as it has been written.
+     * This does not lock or allocate.
+     */
+    void write(std::span<const qreal> values);
+
+    /**
+     * Write a single value.
+     */
+    void write(qreal value);
+
+private:
+    std::unique_ptr<QSharedMemory> m_memory;
+    QString m_errorString;
+    SharedMemorySource::Header *m_header = nullptr;
+    uchar *m_values = nullptr;
+    SharedMemorySource::ValueType m_valueType = SharedMemorySource::Float64;
+    quint64 m_writeCount = 0;
+};
+
+#endif // SHAREDMEMORYWRITER_H
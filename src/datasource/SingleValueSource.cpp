@@ -33,6 +33,12 @@ QVariant SingleValueSource::maximum() const
     return m_value;
 }
 
+void SingleValueSource::readValues(int start, int count, qreal *output) const
+{
+    Q_UNUSED(start);
+    std::fill_n(output, count, m_value.toDouble());
+}
+
 QVariant SingleValueSource::value() const
 {
     return m_value;
@@ -27,6 +27,7 @@ public:
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
 
     Q_PROPERTY(QVariant value READ value WRITE setValue NOTIFY dataChanged)
     QVariant value() const;
@@ -0,0 +1,76 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "SortProxySource.h"
+
+#include <algorithm>
+
+SortProxySource::SortProxySource(QObject *parent)
+    : AsyncProxySource(parent)
+{
+    connect(this, &SortProxySource::sourceChanged, this, &SortProxySource::invalidate);
+    connect(this, &SortProxySource::sortOrderChanged, this, &SortProxySource::invalidate);
+}
+
+ChartDataSource *SortProxySource::source() const
+{
+    return m_source;
+}
+
+void SortProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &SortProxySource::invalidate);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            invalidate();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+Qt::SortOrder SortProxySource::sortOrder() const
+{
+    return m_sortOrder;
+}
+
+void SortProxySource::setSortOrder(Qt::SortOrder newSortOrder)
+{
+    if (newSortOrder == m_sortOrder) {
+        return;
+    }
+
+    m_sortOrder = newSortOrder;
+    Q_EMIT sortOrderChanged();
+}
+
+AsyncProxySource::Task SortProxySource::createTask()
+{
+    if (!m_source) {
+        return Task{};
+    }
+
+    return [values = snapshot(m_source), order = m_sortOrder](Result &result) {
+        result.values.assign(values->cbegin(), values->cend());
+        if (order == Qt::AscendingOrder) {
+            std::sort(result.values.begin(), result.values.end());
+        } else {
+            std::sort(result.values.begin(), result.values.end(), std::greater<qreal>{});
+        }
+    };
+}
+
+#include "moc_SortProxySource.cpp"
@@ -0,0 +1,54 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef SORTPROXYSOURCE_H
+#define SORTPROXYSOURCE_H
+
+#include "AsyncProxySource.h"
+
+/**
+ * A data source that provides the values of a different data source, sorted.
+ *
+ * This can for example be used to show a duration curve, which shows for how
+ * many items a value was exceeded. Sorting happens on a separate thread, see
+ * AsyncProxySource.
+ */
+class QUICKCHARTS_EXPORT SortProxySource : public AsyncProxySource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit SortProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to sort.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * The order to sort values in.
+     *
+     * The default is Qt.AscendingOrder.
+     */
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged)
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder newSortOrder);
+    Q_SIGNAL void sortOrderChanged();
+
+protected:
+    Task createTask() override;
+
+private:
+    ChartDataSource *m_source = nullptr;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+};
+
+#endif // SORTPROXYSOURCE_H
@@ -0,0 +1,168 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef SPANSOURCE_H
+#define SPANSOURCE_H
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source that provides the values of a buffer owned by the application.
+ *
+ * This is intended for C++ applications that already store their data in
+ * contiguous memory, like a std::vector<double>, a std::span<const float> or
+ * the data of an Eigen vector, so it can be shown without copying it into an
+ * ArraySource. The source only refers to the buffer, which should remain
+ * valid until a different buffer is set or the source is destroyed.
+ *
+ * After changing the values of the buffer, the application should call
+ * notifyChanged(), preferably with the range of values that changed. If the
+ * buffer grows or moves, it should be set again using setData().
+ *
+ * \code{.cpp}
+ * std::vector<double> values = readValues();
+ * auto source = new SpanSource<double>(values);
+ * engine.setInitialProperties({{"valueSource", QVariant::fromValue<ChartDataSource *>(source)}});
+ *
+ * values[10] = 5.0;
+ * source->notifyChanged(10, 1);
+ * \endcode
+ *
+ * Reading and comparing values is done using \p T, so no conversion happens
+ * for sources of qreal and values of other types are only converted once.
+ *
+ * This is a template, so it cannot be registered with QML and has the meta
+ * object of ChartDataSource. It should be passed to QML as a ChartDataSource.
+ */
+template<typename T>
+class SpanSource : public ChartDataSource
+{
+    static_assert(std::is_arithmetic_v<T>, "SpanSource requires an arithmetic value type");
+
+public:
+    explicit SpanSource(QObject *parent = nullptr)
+        : ChartDataSource(parent)
+    {
+    }
+
+    explicit SpanSource(std::span<const T> data, QObject *parent = nullptr)
+        : ChartDataSource(parent)
+        , m_data(data)
+    {
+    }
+
+    /**
+     * The buffer this source provides values from.
+     */
+    std::span<const T> data() const
+    {
+        return m_data;
+    }
+
+    /**
+     * Change the buffer this source provides values from.
+     *
+     * If \p data starts at the same address as the current buffer and is
+     * larger, the additional values are treated as appended, so only they
+     * are updated.
+     */
+    void setData(std::span<const T> data)
+    {
+        if (data.data() == m_data.data() && data.size() == m_data.size()) {
+            return;
+        }
+
+        const auto appended = !m_data.empty() && data.data() == m_data.data() && data.size() > m_data.size();
+        const auto previousSize = int(m_data.size());
+        m_data = data;
+
+        if (appended) {
+            Q_EMIT itemsInserted(previousSize, int(m_data.size()) - previousSize);
+        }
+        Q_EMIT dataChanged();
+    }
+
+    /**
+     * Announce that all values of the buffer changed.
+     */
+    void notifyChanged()
+    {
+        Q_EMIT dataChanged();
+    }
+
+    /**
+     * Announce that \p count values starting at \p start changed.
+     */
+    void notifyChanged(int start, int count)
+    {
+        start = std::max(start, 0);
+        count = std::min(count, itemCount() - start);
+        if (count <= 0) {
+            return;
+        }
+
+        Q_EMIT itemsChanged(start, count);
+        Q_EMIT dataChanged();
+    }
+
+    int itemCount() const override
+    {
+        return int(m_data.size());
+    }
+
+    QVariant item(int index) const override
+    {
+        if (index < 0 || index >= itemCount()) {
+            return QVariant{};
+        }
+
+        return qreal(m_data[index]);
+    }
+
+    QVariant minimum() const override
+    {
+        return cachedMinimum([this]() {
+            auto itr = std::min_element(m_data.begin(), m_data.end());
+            if (itr != m_data.end()) {
+                return QVariant{qreal(*itr)};
+            }
+            return QVariant{};
+        });
+    }
+
+    QVariant maximum() const override
+    {
+        return cachedMaximum([this]() {
+            auto itr = std::max_element(m_data.begin(), m_data.end());
+            if (itr != m_data.end()) {
+                return QVariant{qreal(*itr)};
+            }
+            return QVariant{};
+        });
+    }
+
+    void readValues(int start, int count, qreal *output) const override
+    {
+        std::fill_n(output, count, 0.0);
+
+        const auto first = std::max(start, 0);
+        const auto last = std::min(start + count, itemCount());
+        if (first < last) {
+            // For qreal, this is a plain copy of memory.
+            std::copy(m_data.begin() + first, m_data.begin() + last, output + (first - start));
+        }
+    }
+
+private:
+    std::span<const T> m_data;
+};
+
+#endif // SPANSOURCE_H
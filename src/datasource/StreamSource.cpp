@@ -0,0 +1,511 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "StreamSource.h"
+
+#include <atomic>
+#include <cerrno>
+
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QtEndian>
+
+#ifdef HAVE_QTNETWORK
+#include <QLocalSocket>
+#endif
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include "charts_datasource_logging.h"
+
+// Reads and parses the stream on a separate thread. Parsed values are
+// collected in pending, which the source takes at regular intervals. This is
+// shared with the thread, so the source can be destroyed while reading.
+struct StreamSource::Reader {
+    Reader();
+    ~Reader();
+
+    QString fileName;
+    QString socketName;
+    Format format = Csv;
+    int column = 0;
+    char separator = ',';
+    int columnCount = 1;
+    ValueType valueType = Float64;
+
+    std::atomic<bool> cancelled = false;
+#ifdef Q_OS_UNIX
+    // Written to by cancel() to wake up a reader waiting for data.
+    int wakeFds[2] = {-1, -1};
+#endif
+
+    QMutex mutex;
+    std::vector<double> pending;
+    bool finished = false;
+    QString error;
+
+    // Incomplete line or frame, only used by the reading thread.
+    QByteArray remainder;
+
+    void run();
+    void readSocket();
+    void readFile();
+    void cancel();
+    void parse(const QByteArray &data, bool atEnd);
+    void parseLine(QByteArrayView line, std::vector<double> &values) const;
+    void finish(const QString &errorString = QString{});
+};
+
+static constexpr qint64 chunkSize = 64 * 1024;
+
+StreamSource::Reader::Reader()
+{
+#ifdef Q_OS_UNIX
+    if (::pipe(wakeFds) == 0) {
+        ::fcntl(wakeFds[0], F_SETFD, FD_CLOEXEC);
+        ::fcntl(wakeFds[1], F_SETFD, FD_CLOEXEC);
+    }
+#endif
+}
+
+StreamSource::Reader::~Reader()
+{
+#ifdef Q_OS_UNIX
+    for (auto fd : wakeFds) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+void StreamSource::Reader::run()
+{
+    if (format == Binary && (column < 0 || column >= columnCount)) {
+        finish(QStringLiteral("Column %1 is not part of a frame of %2 values").arg(column).arg(columnCount));
+        return;
+    }
+
+    if (!socketName.isEmpty()) {
+        readSocket();
+    } else {
+        readFile();
+    }
+}
+
+void StreamSource::Reader::readSocket()
+{
+#ifdef HAVE_QTNETWORK
+    QLocalSocket socket;
+    socket.connectToServer(socketName, QIODevice::ReadOnly);
+
+    // Wake up regularly to check whether reading should stop.
+    while (!cancelled && socket.state() == QLocalSocket::ConnectingState) {
+        socket.waitForConnected(100);
+    }
+    if (cancelled) {
+        finish();
+        return;
+    }
+    if (socket.state() != QLocalSocket::ConnectedState) {
+        finish(socket.errorString());
+        return;
+    }
+
+    while (!cancelled) {
+        if (socket.bytesAvailable() == 0 && !socket.waitForReadyRead(100)) {
+            if (socket.state() != QLocalSocket::ConnectedState) {
+                break;
+            }
+            continue;
+        }
+        parse(socket.read(chunkSize), false);
+    }
+
+    parse(QByteArray{}, true);
+    finish();
+#else
+    finish(QStringLiteral("Reading from local sockets is not supported by this build"));
+#endif
+}
+
+void StreamSource::Reader::readFile()
+{
+#ifdef Q_OS_UNIX
+    // Opening without blocking means opening a named pipe does not wait for a
+    // writer, and waiting for data using poll() can be interrupted by cancel().
+    const int fd = ::open(QFile::encodeName(fileName).constData(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        finish(qt_error_string(errno));
+        return;
+    }
+
+    QByteArray buffer(chunkSize, Qt::Uninitialized);
+    pollfd fds[] = {{fd, POLLIN, 0}, {wakeFds[0], POLLIN, 0}};
+    QString error;
+    while (!cancelled) {
+        if (::poll(fds, wakeFds[0] >= 0 ? 2 : 1, 100) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error = qt_error_string(errno);
+            break;
+        }
+
+        if (fds[0].revents == 0) {
+            continue;
+        }
+
+        const auto size = ::read(fd, buffer.data(), chunkSize);
+        if (size < 0) {
+            if (errno == EAGAIN || errno == EINTR) {
+                continue;
+            }
+            error = qt_error_string(errno);
+            break;
+        }
+
+        // The end of a file, or a pipe of which all writers are gone.
+        if (size == 0) {
+            break;
+        }
+        parse(QByteArray(buffer.constData(), size), false);
+    }
+    ::close(fd);
+
+    if (!error.isEmpty()) {
+        finish(error);
+        return;
+    }
+#else
+    // Unbuffered, so reading from a pipe returns whatever is available
+    // rather than waiting for a full chunk.
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        finish(file.errorString());
+        return;
+    }
+
+    while (!cancelled) {
+        const auto data = file.read(chunkSize);
+        if (data.isEmpty()) {
+            break;
+        }
+        parse(data, false);
+    }
+#endif
+
+    parse(QByteArray{}, true);
+    finish();
+}
+
+void StreamSource::Reader::cancel()
+{
+    cancelled = true;
+#ifdef Q_OS_UNIX
+    if (wakeFds[1] >= 0) {
+        const char byte = 0;
+        [[maybe_unused]] const auto written = ::write(wakeFds[1], &byte, 1);
+    }
+#endif
+}
+
+void StreamSource::Reader::parse(const QByteArray &data, bool atEnd)
+{
+    remainder.append(data);
+
+    std::vector<double> values;
+    qsizetype consumed = 0;
+
+    if (format == Csv) {
+        while (true) {
+            auto end = remainder.indexOf('\n', consumed);
+            if (end < 0) {
+                if (!atEnd || consumed == remainder.size()) {
+                    break;
+                }
+                end = remainder.size();
+            }
+
+            parseLine(QByteArrayView(remainder).sliced(consumed, end - consumed), values);
+            consumed = std::min(end + 1, remainder.size());
+        }
+    } else {
+        const auto valueSize = valueType == Float32 ? qsizetype(sizeof(float)) : qsizetype(sizeof(double));
+        const auto frameSize = valueSize * columnCount;
+        while (remainder.size() - consumed >= frameSize) {
+            const auto data = remainder.constData() + consumed + column * valueSize;
+            values.push_back(valueType == Float32 ? double(qFromLittleEndian<float>(data)) : qFromLittleEndian<double>(data));
+            consumed += frameSize;
+        }
+    }
+
+    remainder.remove(0, consumed);
+
+    if (!values.empty()) {
+        QMutexLocker locker(&mutex);
+        pending.insert(pending.end(), values.cbegin(), values.cend());
+    }
+}
+
+void StreamSource::Reader::parseLine(QByteArrayView line, std::vector<double> &values) const
+{
+    qsizetype start = 0;
+    for (int i = 0; i < column; ++i) {
+        start = line.indexOf(separator, start);
+        if (start < 0) {
+            return;
+        }
+        start++;
+    }
+
+    auto end = line.indexOf(separator, start);
+    if (end < 0) {
+        end = line.size();
+    }
+
+    bool ok = false;
+    const auto value = line.sliced(start, end - start).trimmed().toDouble(&ok);
+    if (ok) {
+        values.push_back(value);
+    }
+}
+
+void StreamSource::Reader::finish(const QString &errorString)
+{
+    QMutexLocker locker(&mutex);
+    error = errorString;
+    finished = true;
+}
+
+StreamSource::StreamSource(QObject *parent)
+    : HistorySource(parent)
+{
+    // Publish at most once per frame.
+    m_publishTimer.setInterval(16);
+    connect(&m_publishTimer, &QTimer::timeout, this, &StreamSource::publish);
+
+    connect(this, &StreamSource::fileNameChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::socketNameChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::formatChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::columnChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::separatorChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::columnCountChanged, this, &StreamSource::queueStart);
+    connect(this, &StreamSource::valueTypeChanged, this, &StreamSource::queueStart);
+}
+
+StreamSource::~StreamSource()
+{
+    stop();
+}
+
+QString StreamSource::fileName() const
+{
+    return m_fileName;
+}
+
+void StreamSource::setFileName(const QString &newFileName)
+{
+    if (newFileName == m_fileName) {
+        return;
+    }
+
+    m_fileName = newFileName;
+    Q_EMIT fileNameChanged();
+}
+
+QString StreamSource::socketName() const
+{
+    return m_socketName;
+}
+
+void StreamSource::setSocketName(const QString &newSocketName)
+{
+    if (newSocketName == m_socketName) {
+        return;
+    }
+
+    m_socketName = newSocketName;
+    Q_EMIT socketNameChanged();
+}
+
+StreamSource::Format StreamSource::format() const
+{
+    return m_format;
+}
+
+void StreamSource::setFormat(Format newFormat)
+{
+    if (newFormat == m_format) {
+        return;
+    }
+
+    m_format = newFormat;
+    Q_EMIT formatChanged();
+}
+
+int StreamSource::column() const
+{
+    return m_column;
+}
+
+void StreamSource::setColumn(int newColumn)
+{
+    if (newColumn == m_column) {
+        return;
+    }
+
+    m_column = newColumn;
+    Q_EMIT columnChanged();
+}
+
+QString StreamSource::separator() const
+{
+    return m_separator;
+}
+
+void StreamSource::setSeparator(const QString &newSeparator)
+{
+    if (newSeparator == m_separator) {
+        return;
+    }
+
+    m_separator = newSeparator;
+    Q_EMIT separatorChanged();
+}
+
+int StreamSource::columnCount() const
+{
+    return m_columnCount;
+}
+
+void StreamSource::setColumnCount(int newColumnCount)
+{
+    if (newColumnCount == m_columnCount) {
+        return;
+    }
+
+    m_columnCount = newColumnCount;
+    Q_EMIT columnCountChanged();
+}
+
+StreamSource::ValueType StreamSource::valueType() const
+{
+    return m_valueType;
+}
+
+void StreamSource::setValueType(ValueType newValueType)
+{
+    if (newValueType == m_valueType) {
+        return;
+    }
+
+    m_valueType = newValueType;
+    Q_EMIT valueTypeChanged();
+}
+
+void StreamSource::queueStart()
+{
+    if (!m_startQueued) {
+        m_startQueued = true;
+        QMetaObject::invokeMethod(this, &StreamSource::start, Qt::QueuedConnection);
+    }
+}
+
+void StreamSource::start()
+{
+    m_startQueued = false;
+
+    stop();
+    m_errorString.clear();
+
+    if (m_fileName.isEmpty() && m_socketName.isEmpty()) {
+        setStatus(Null);
+        return;
+    }
+
+    auto reader = std::make_shared<Reader>();
+    reader->fileName = m_fileName;
+    reader->socketName = m_socketName;
+    reader->format = m_format;
+    reader->column = m_column;
+    reader->separator = m_separator.isEmpty() ? ',' : m_separator.at(0).toLatin1();
+    reader->columnCount = m_columnCount;
+    reader->valueType = m_valueType;
+    m_reader = reader;
+
+    m_thread.reset(QThread::create([reader]() {
+        reader->run();
+    }));
+    m_thread->start();
+
+    m_publishTimer.start();
+    setStatus(Active);
+}
+
+void StreamSource::stop()
+{
+    if (m_reader) {
+        m_reader->cancel();
+        m_reader.reset();
+    }
+
+    // Reading is interrupted by cancel(), so this does not block for long.
+    if (m_thread) {
+        m_thread->wait();
+        m_thread.reset();
+    }
+
+    m_publishTimer.stop();
+}
+
+void StreamSource::publish()
+{
+    if (!m_reader) {
+        return;
+    }
+
+    std::vector<double> values;
+    bool finished = false;
+    QString error;
+    {
+        QMutexLocker locker(&m_reader->mutex);
+        values.swap(m_reader->pending);
+        finished = m_reader->finished;
+        error = m_reader->error;
+    }
+
+    appendValues(values.data(), int(values.size()));
+
+    if (finished) {
+        stop();
+        if (!error.isEmpty()) {
+            qCWarning(DATASOURCE) << "StreamSource: Could not read stream" << error;
+            m_errorString = error;
+            setStatus(Error);
+        } else {
+            setStatus(Finished);
+        }
+    }
+}
+
+void StreamSource::setStatus(Status newStatus)
+{
+    if (newStatus == m_status) {
+        return;
+    }
+
+    m_status = newStatus;
+    Q_EMIT statusChanged();
+}
+
+#include "moc_StreamSource.cpp"
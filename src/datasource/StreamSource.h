@@ -0,0 +1,191 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef STREAMSOURCE_H
+#define STREAMSOURCE_H
+
+#include <memory>
+
+#include <QThread>
+#include <QTimer>
+
+#include "HistorySource.h"
+
+/**
+ * A data source that reads values from a stream.
+ *
+ * This reads from a file, a named pipe or a local socket on a separate thread
+ * and parses values as they arrive, either from a column of comma-separated
+ * text or from frames of binary floating point numbers. Parsed values are
+ * collected and added to the source at most once per frame.
+ *
+ * Values are stored like \ref HistoryProxySource does, with the most recent
+ * value as item 0 and at most \ref maximumHistory values.
+ *
+ * Reading stops as soon as a property changes or the source is destroyed,
+ * even while waiting for data, for example from a named pipe without a
+ * writer.
+ */
+class QUICKCHARTS_EXPORT StreamSource : public HistorySource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /**
+     * The format of the stream.
+     */
+    enum Format {
+        /**
+         * Lines of text with values separated by \ref separator. Lines where
+         * \ref column does not contain a number, like a header, are ignored.
+         */
+        Csv,
+        /**
+         * Frames of \ref columnCount little-endian floating point numbers of
+         * \ref valueType.
+         */
+        Binary,
+    };
+    Q_ENUM(Format)
+
+    /**
+     * The type of the numbers in a binary stream.
+     */
+    enum ValueType {
+        Float32, ///< 32-bit floating point numbers.
+        Float64, ///< 64-bit floating point numbers.
+    };
+    Q_ENUM(ValueType)
+
+    /**
+     * The different states of the source.
+     */
+    enum Status {
+        Null, ///< Neither \ref fileName nor \ref socketName has been set.
+        Active, ///< The stream is being read.
+        Finished, ///< The end of the stream has been reached.
+        Error, ///< The stream could not be read, see \ref errorString.
+    };
+    Q_ENUM(Status)
+
+    explicit StreamSource(QObject *parent = nullptr);
+    ~StreamSource() override;
+
+    /**
+     * The path of a file or named pipe to read from.
+     *
+     * The file is read until its end is reached. Ignored if \ref socketName is
+     * set.
+     */
+    Q_PROPERTY(QString fileName READ fileName WRITE setFileName NOTIFY fileNameChanged)
+    QString fileName() const;
+    void setFileName(const QString &newFileName);
+    Q_SIGNAL void fileNameChanged();
+
+    /**
+     * The name of a local socket server to read from.
+     *
+     * This requires KQuickCharts to be built with Qt Network, otherwise
+     * the status becomes Error.
+     *
+     * \see QLocalSocket::connectToServer()
+     */
+    Q_PROPERTY(QString socketName READ socketName WRITE setSocketName NOTIFY socketNameChanged)
+    QString socketName() const;
+    void setSocketName(const QString &newSocketName);
+    Q_SIGNAL void socketNameChanged();
+
+    /**
+     * The format of the stream.
+     *
+     * Defaults to Csv.
+     */
+    Q_PROPERTY(Format format READ format WRITE setFormat NOTIFY formatChanged)
+    Format format() const;
+    void setFormat(Format newFormat);
+    Q_SIGNAL void formatChanged();
+
+    /**
+     * The column to read values from.
+     *
+     * Defaults to 0.
+     */
+    Q_PROPERTY(int column READ column WRITE setColumn NOTIFY columnChanged)
+    int column() const;
+    void setColumn(int newColumn);
+    Q_SIGNAL void columnChanged();
+
+    /**
+     * The character separating columns of a Csv stream.
+     *
+     * Defaults to ",".
+     */
+    Q_PROPERTY(QString separator READ separator WRITE setSeparator NOTIFY separatorChanged)
+    QString separator() const;
+    void setSeparator(const QString &newSeparator);
+    Q_SIGNAL void separatorChanged();
+
+    /**
+     * The number of values in each frame of a Binary stream.
+     *
+     * Defaults to 1.
+     */
+    Q_PROPERTY(int columnCount READ columnCount WRITE setColumnCount NOTIFY columnCountChanged)
+    int columnCount() const;
+    void setColumnCount(int newColumnCount);
+    Q_SIGNAL void columnCountChanged();
+
+    /**
+     * The type of the values of a Binary stream.
+     *
+     * Defaults to Float64.
+     */
+    Q_PROPERTY(ValueType valueType READ valueType WRITE setValueType NOTIFY valueTypeChanged)
+    ValueType valueType() const;
+    void setValueType(ValueType newValueType);
+    Q_SIGNAL void valueTypeChanged();
+
+    /**
+     * The current status of the source.
+     */
+    Q_PROPERTY(Status status READ status NOTIFY statusChanged)
+    Status status() const;
+    Q_SIGNAL void statusChanged();
+
+    /**
+     * A description of the error if \ref status is Error.
+     */
+    Q_PROPERTY(QString errorString READ errorString NOTIFY statusChanged)
+    QString errorString() const;
+
+private:
+    struct Reader;
+
+    void queueStart();
+    void start();
+    void stop();
+    void publish();
+    void setStatus(Status newStatus);
+
+    QString m_fileName;
+    QString m_socketName;
+    Format m_format = Csv;
+    int m_column = 0;
+    QString m_separator = QStringLiteral(",");
+    int m_columnCount = 1;
+    ValueType m_valueType = Float64;
+    Status m_status = Null;
+    QString m_errorString;
+    bool m_startQueued = false;
+
+    QTimer m_publishTimer;
+    std::shared_ptr<Reader> m_reader;
+    std::unique_ptr<QThread> m_thread;
+};
+
+#endif // STREAMSOURCE_H
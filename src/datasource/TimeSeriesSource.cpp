@@ -0,0 +1,228 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "TimeSeriesSource.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "charts_datasource_logging.h"
+
+TimeSeriesSource::TimeSeriesSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+}
+
+int TimeSeriesSource::maximumItems() const
+{
+    return m_maximumItems;
+}
+
+void TimeSeriesSource::setMaximumItems(int newMaximumItems)
+{
+    if (newMaximumItems == m_maximumItems) {
+        return;
+    }
+
+    m_maximumItems = newMaximumItems;
+
+    if (const auto removed = removeExpired(); removed > 0) {
+        Q_EMIT itemsRemoved(0, removed);
+        Q_EMIT dataChanged();
+    }
+
+    Q_EMIT maximumItemsChanged();
+}
+
+qreal TimeSeriesSource::maximumAge() const
+{
+    return m_maximumAge;
+}
+
+void TimeSeriesSource::setMaximumAge(qreal newMaximumAge)
+{
+    if (qFuzzyCompare(newMaximumAge, m_maximumAge)) {
+        return;
+    }
+
+    m_maximumAge = newMaximumAge;
+
+    if (const auto removed = removeExpired(); removed > 0) {
+        Q_EMIT itemsRemoved(0, removed);
+        Q_EMIT dataChanged();
+    }
+
+    Q_EMIT maximumAgeChanged();
+}
+
+void TimeSeriesSource::append(qreal x, qreal y)
+{
+    append(std::span<const qreal>(&x, 1), std::span<const qreal>(&y, 1));
+}
+
+void TimeSeriesSource::append(std::span<const qreal> x, std::span<const qreal> y)
+{
+    if (x.size() != y.size()) {
+        qCWarning(DATASOURCE) << "TimeSeriesSource: Got" << x.size() << "X values for" << y.size() << "values";
+    }
+
+    const auto count = std::min(x.size(), y.size());
+
+    // The inserted items are only announced as a single insertion when they
+    // end up next to each other. Inserting at a position within or directly
+    // after the block of items inserted so far keeps the block contiguous.
+    auto blockStart = -1;
+    auto blockEnd = -1;
+    auto contiguous = true;
+    auto inserted = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::isnan(x[i])) {
+            continue;
+        }
+
+        auto position = int(m_x.size());
+        if (m_x.empty() || x[i] >= m_x.back()) {
+            m_x.push_back(x[i]);
+            m_y.push_back(y[i]);
+        } else {
+            // Items with the same X value stay in the order they were added.
+            position = std::upper_bound(m_x.cbegin(), m_x.cend(), x[i]) - m_x.cbegin();
+            m_x.insert(m_x.cbegin() + position, x[i]);
+            m_y.insert(m_y.cbegin() + position, y[i]);
+        }
+
+        if (inserted == 0) {
+            blockStart = position;
+            blockEnd = position + 1;
+        } else if (position >= blockStart && position <= blockEnd) {
+            blockEnd++;
+        } else {
+            contiguous = false;
+        }
+        inserted++;
+    }
+
+    if (inserted == 0) {
+        return;
+    }
+
+    // Items inserted at separate positions can not be described by a single
+    // insertion, so only dataChanged is emitted, which is treated as a reset.
+    if (contiguous) {
+        Q_EMIT itemsInserted(blockStart, inserted);
+    }
+    if (const auto removed = removeExpired(); removed > 0 && contiguous) {
+        Q_EMIT itemsRemoved(0, removed);
+    }
+    Q_EMIT dataChanged();
+}
+
+qreal TimeSeriesSource::xValue(int index) const
+{
+    if (index < 0 || index >= int(m_x.size())) {
+        return 0.0;
+    }
+
+    return m_x[index];
+}
+
+void TimeSeriesSource::clear()
+{
+    if (m_x.empty()) {
+        return;
+    }
+
+    m_x.clear();
+    m_y.clear();
+    Q_EMIT dataChanged();
+}
+
+int TimeSeriesSource::itemCount() const
+{
+    return int(m_y.size());
+}
+
+QVariant TimeSeriesSource::item(int index) const
+{
+    if (index < 0 || index >= int(m_y.size())) {
+        return QVariant{};
+    }
+
+    return m_y[index];
+}
+
+QVariant TimeSeriesSource::minimum() const
+{
+    return cachedMinimum([this]() {
+        auto itr = std::min_element(m_y.cbegin(), m_y.cend());
+        if (itr != m_y.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+QVariant TimeSeriesSource::maximum() const
+{
+    return cachedMaximum([this]() {
+        auto itr = std::max_element(m_y.cbegin(), m_y.cend());
+        if (itr != m_y.cend()) {
+            return QVariant{*itr};
+        }
+        return QVariant{};
+    });
+}
+
+void TimeSeriesSource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_y.size()));
+    if (first < last) {
+        std::copy(m_y.cbegin() + first, m_y.cbegin() + last, output + (first - start));
+    }
+}
+
+bool TimeSeriesSource::hasXValues() const
+{
+    return true;
+}
+
+void TimeSeriesSource::readXValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, int(m_x.size()));
+    if (first < last) {
+        std::copy(m_x.cbegin() + first, m_x.cbegin() + last, output + (first - start));
+    }
+}
+
+int TimeSeriesSource::lowerBoundX(qreal x) const
+{
+    return int(std::lower_bound(m_x.cbegin(), m_x.cend(), x) - m_x.cbegin());
+}
+
+int TimeSeriesSource::removeExpired()
+{
+    auto removed = 0;
+    if (m_maximumItems > 0 && int(m_x.size()) > m_maximumItems) {
+        removed = int(m_x.size()) - m_maximumItems;
+    }
+
+    if (m_maximumAge > 0.0 && !m_x.empty()) {
+        removed = std::max(removed, lowerBoundX(m_x.back() - m_maximumAge));
+    }
+
+    m_x.erase(m_x.cbegin(), m_x.cbegin() + removed);
+    m_y.erase(m_y.cbegin(), m_y.cbegin() + removed);
+    return removed;
+}
+
+#include "moc_TimeSeriesSource.cpp"
@@ -0,0 +1,111 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef TIMESERIESSOURCE_H
+#define TIMESERIESSOURCE_H
+
+#include <deque>
+#include <span>
+
+#include "ChartDataSource.h"
+
+/**
+ * A data source of values with an X value, like a timestamp, for each item.
+ *
+ * Items are kept sorted by X value, oldest first, so this can be used for
+ * irregularly sampled data. Charts place items according to their X value,
+ * with the X range of the chart in the same units. Only the items within that
+ * range are processed, which are found using a binary search, so showing the
+ * last few minutes of a long history is cheap.
+ *
+ * \code{.qml}
+ * TimeSeriesSource {
+ *     id: source
+ *     maximumAge: 24 * 60 * 60 * 1000
+ * }
+ *
+ * LineChart {
+ *     valueSources: source
+ *     xRange {
+ *         automatic: false
+ *         from: Date.now() - 5 * 60 * 1000
+ *         to: Date.now()
+ *     }
+ * }
+ * \endcode
+ */
+class QUICKCHARTS_EXPORT TimeSeriesSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit TimeSeriesSource(QObject *parent = nullptr);
+
+    /**
+     * The maximum number of items to keep.
+     *
+     * When exceeded, the items with the smallest X values are removed. The
+     * default is 0, which means there is no maximum.
+     */
+    Q_PROPERTY(int maximumItems READ maximumItems WRITE setMaximumItems NOTIFY maximumItemsChanged)
+    int maximumItems() const;
+    void setMaximumItems(int newMaximumItems);
+    Q_SIGNAL void maximumItemsChanged();
+
+    /**
+     * The maximum difference between the largest X value and that of any
+     * other item.
+     *
+     * Items with a smaller X value are removed. The default is 0, which means
+     * there is no maximum.
+     */
+    Q_PROPERTY(qreal maximumAge READ maximumAge WRITE setMaximumAge NOTIFY maximumAgeChanged)
+    qreal maximumAge() const;
+    void setMaximumAge(qreal newMaximumAge);
+    Q_SIGNAL void maximumAgeChanged();
+
+    /**
+     * Add an item with X value \p x and value \p y.
+     */
+    Q_INVOKABLE void append(qreal x, qreal y);
+    /**
+     * Add several items.
+     *
+     * \p x and \p y should have the same size. Adding items in ascending X
+     * order, after the existing items, is cheapest. When the new items do not
+     * end up next to each other, the change is announced as a reset.
+     */
+    void append(std::span<const qreal> x, std::span<const qreal> y);
+    /**
+     * The X value of the item at \p index.
+     */
+    Q_INVOKABLE qreal xValue(int index) const;
+    /**
+     * Remove all items.
+     */
+    Q_INVOKABLE void clear();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+    bool hasXValues() const override;
+    void readXValues(int start, int count, qreal *output) const override;
+    int lowerBoundX(qreal x) const override;
+
+private:
+    int removeExpired();
+
+    int m_maximumItems = 0;
+    qreal m_maximumAge = 0.0;
+    std::deque<qreal> m_x;
+    std::deque<qreal> m_y;
+};
+
+#endif // TIMESERIESSOURCE_H
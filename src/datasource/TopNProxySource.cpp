@@ -0,0 +1,398 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "TopNProxySource.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+// Whether item a should be ordered before item b. Larger values come first,
+// equal values by index, and NaN is treated as the smallest value so the
+// order is strict.
+static bool isLarger(qreal a, int indexA, qreal b, int indexB)
+{
+    if (std::isnan(a)) {
+        a = -std::numeric_limits<qreal>::infinity();
+    }
+    if (std::isnan(b)) {
+        b = -std::numeric_limits<qreal>::infinity();
+    }
+    return a > b || (a == b && indexA < indexB);
+}
+
+TopNCompanionSource::TopNCompanionSource(TopNProxySource *proxy, Role role)
+    : ChartDataSource(proxy)
+    , m_proxy(proxy)
+    , m_role(role)
+{
+}
+
+int TopNCompanionSource::itemCount() const
+{
+    return m_proxy->itemCount();
+}
+
+QVariant TopNCompanionSource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    if (index < int(m_proxy->m_selection.size())) {
+        const auto source = m_role == Names ? m_proxy->m_nameSource : m_proxy->m_colorSource;
+        return source ? source->item(m_proxy->m_selection[index]) : QVariant{};
+    }
+
+    return m_role == Names ? QVariant{m_proxy->m_otherName} : QVariant{m_proxy->m_otherColor};
+}
+
+QVariant TopNCompanionSource::minimum() const
+{
+    return QVariant{};
+}
+
+QVariant TopNCompanionSource::maximum() const
+{
+    return QVariant{};
+}
+
+TopNProxySource::TopNProxySource(QObject *parent)
+    : ChartDataSource(parent)
+    , m_names(new TopNCompanionSource(this, TopNCompanionSource::Names))
+    , m_colors(new TopNCompanionSource(this, TopNCompanionSource::Colors))
+{
+    connect(this, &TopNProxySource::sourceChanged, this, &TopNProxySource::update);
+    connect(this, &TopNProxySource::countChanged, this, &TopNProxySource::update);
+    connect(this, &TopNProxySource::nameSourceChanged, m_names, &ChartDataSource::dataChanged);
+    connect(this, &TopNProxySource::otherNameChanged, m_names, &ChartDataSource::dataChanged);
+    connect(this, &TopNProxySource::colorSourceChanged, m_colors, &ChartDataSource::dataChanged);
+    connect(this, &TopNProxySource::otherColorChanged, m_colors, &ChartDataSource::dataChanged);
+}
+
+ChartDataSource *TopNProxySource::source() const
+{
+    return m_source;
+}
+
+void TopNProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::dataChanged, this, &TopNProxySource::onSourceDataChanged);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update();
+        });
+    }
+    Q_EMIT sourceChanged();
+}
+
+ChartDataSource *TopNProxySource::nameSource() const
+{
+    return m_nameSource;
+}
+
+void TopNProxySource::setNameSource(ChartDataSource *newNameSource)
+{
+    if (newNameSource == m_nameSource) {
+        return;
+    }
+
+    if (m_nameSource) {
+        m_nameSource->disconnect(this);
+        m_nameSource->disconnect(m_names);
+    }
+
+    m_nameSource = newNameSource;
+    if (m_nameSource) {
+        connect(m_nameSource, &ChartDataSource::dataChanged, m_names, &ChartDataSource::dataChanged);
+        connect(m_nameSource, &QObject::destroyed, this, [this]() {
+            m_nameSource = nullptr;
+            Q_EMIT m_names->dataChanged();
+        });
+    }
+    Q_EMIT nameSourceChanged();
+}
+
+ChartDataSource *TopNProxySource::colorSource() const
+{
+    return m_colorSource;
+}
+
+void TopNProxySource::setColorSource(ChartDataSource *newColorSource)
+{
+    if (newColorSource == m_colorSource) {
+        return;
+    }
+
+    if (m_colorSource) {
+        m_colorSource->disconnect(this);
+        m_colorSource->disconnect(m_colors);
+    }
+
+    m_colorSource = newColorSource;
+    if (m_colorSource) {
+        connect(m_colorSource, &ChartDataSource::dataChanged, m_colors, &ChartDataSource::dataChanged);
+        connect(m_colorSource, &QObject::destroyed, this, [this]() {
+            m_colorSource = nullptr;
+            Q_EMIT m_colors->dataChanged();
+        });
+    }
+    Q_EMIT colorSourceChanged();
+}
+
+int TopNProxySource::count() const
+{
+    return m_count;
+}
+
+void TopNProxySource::setCount(int newCount)
+{
+    newCount = std::max(newCount, 0);
+    if (newCount == m_count) {
+        return;
+    }
+
+    m_count = newCount;
+    Q_EMIT countChanged();
+}
+
+QString TopNProxySource::otherName() const
+{
+    return m_otherName;
+}
+
+void TopNProxySource::setOtherName(const QString &newOtherName)
+{
+    if (newOtherName == m_otherName) {
+        return;
+    }
+
+    m_otherName = newOtherName;
+    Q_EMIT otherNameChanged();
+}
+
+QColor TopNProxySource::otherColor() const
+{
+    return m_otherColor;
+}
+
+void TopNProxySource::setOtherColor(const QColor &newOtherColor)
+{
+    if (newOtherColor == m_otherColor) {
+        return;
+    }
+
+    m_otherColor = newOtherColor;
+    Q_EMIT otherColorChanged();
+}
+
+ChartDataSource *TopNProxySource::names() const
+{
+    return m_names;
+}
+
+ChartDataSource *TopNProxySource::colors() const
+{
+    return m_colors;
+}
+
+int TopNProxySource::sourceIndex(int index) const
+{
+    if (index < 0 || index >= int(m_selection.size())) {
+        return -1;
+    }
+
+    return m_selection[index];
+}
+
+int TopNProxySource::itemCount() const
+{
+    return m_selection.size() + (hasOther() ? 1 : 0);
+}
+
+QVariant TopNProxySource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    if (index < int(m_selection.size())) {
+        return m_sourceValues[m_selection[index]];
+    }
+
+    return m_otherSum;
+}
+
+QVariant TopNProxySource::minimum() const
+{
+    return cachedMinimum([this]() {
+        if (itemCount() == 0) {
+            return QVariant{};
+        }
+
+        std::vector<qreal> values(itemCount());
+        readValues(0, int(values.size()), values.data());
+        return QVariant{*std::min_element(values.cbegin(), values.cend())};
+    });
+}
+
+QVariant TopNProxySource::maximum() const
+{
+    return cachedMaximum([this]() {
+        if (itemCount() == 0) {
+            return QVariant{};
+        }
+
+        std::vector<qreal> values(itemCount());
+        readValues(0, int(values.size()), values.data());
+        return QVariant{*std::max_element(values.cbegin(), values.cend())};
+    });
+}
+
+void TopNProxySource::readValues(int start, int count, qreal *output) const
+{
+    std::fill_n(output, count, 0.0);
+
+    const auto first = std::max(start, 0);
+    const auto last = std::min(start + count, itemCount());
+    for (int index = first; index < last; ++index) {
+        output[index - start] = index < int(m_selection.size()) ? m_sourceValues[m_selection[index]] : m_otherSum;
+    }
+}
+
+void TopNProxySource::update()
+{
+    const auto count = m_source ? m_source->itemCount() : 0;
+    m_sourceValues.resize(count);
+    if (count > 0) {
+        m_source->readValues(0, count, m_sourceValues.data());
+    }
+
+    auto larger = [this](int a, int b) {
+        return isLarger(m_sourceValues[a], a, m_sourceValues[b], b);
+    };
+
+    // Partially select the largest items, then sort only those.
+    std::vector<int> indices(count);
+    std::iota(indices.begin(), indices.end(), 0);
+    const auto selected = std::min(m_count, count);
+    std::nth_element(indices.begin(), indices.begin() + selected, indices.end(), larger);
+    std::sort(indices.begin(), indices.begin() + selected, larger);
+
+    m_selection.assign(indices.cbegin(), indices.cbegin() + selected);
+    m_selected.assign(count, false);
+    for (auto index : m_selection) {
+        m_selected[index] = true;
+    }
+
+    m_otherSum = 0.0;
+    for (int index = 0; index < count; ++index) {
+        if (!m_selected[index]) {
+            m_otherSum += m_sourceValues[index];
+        }
+    }
+
+    Q_EMIT dataChanged();
+    Q_EMIT m_names->dataChanged();
+    Q_EMIT m_colors->dataChanged();
+}
+
+void TopNProxySource::onSourceDataChanged()
+{
+    const auto change = m_source->lastChange();
+    const auto count = m_source->itemCount();
+    const auto previousCount = int(m_sourceValues.size());
+
+    if (change.isReset()) {
+        update();
+        return;
+    }
+
+    auto first = 0;
+    auto last = 0;
+    if (!change.itemCountChanged && count == previousCount) {
+        first = change.start;
+        last = std::min(change.start + change.count, count);
+    } else if (change.start == previousCount && count > previousCount) {
+        first = previousCount;
+        last = count;
+    } else {
+        update();
+        return;
+    }
+
+    if (first >= last) {
+        return;
+    }
+
+    std::vector<qreal> values(last - first);
+    m_source->readValues(first, int(values.size()), values.data());
+
+    // Changes that affect the largest items require selecting them again.
+    // Anything else only changes the sum of the other items.
+    for (int i = 0; i < int(values.size()); ++i) {
+        const auto index = first + i;
+        if ((index < previousCount && m_selected[index]) || isAboveSelection(index, values[i])) {
+            update();
+            return;
+        }
+    }
+
+    const auto hadOther = hasOther();
+
+    m_sourceValues.resize(count);
+    m_selected.resize(count, false);
+    for (int i = 0; i < int(values.size()); ++i) {
+        const auto index = first + i;
+        m_otherSum += values[i] - (index < previousCount ? m_sourceValues[index] : 0.0);
+        m_sourceValues[index] = values[i];
+    }
+
+    const auto otherIndex = int(m_selection.size());
+    if (hadOther) {
+        Q_EMIT itemsChanged(otherIndex, 1);
+        Q_EMIT dataChanged();
+    } else {
+        for (auto source : {static_cast<ChartDataSource *>(this), static_cast<ChartDataSource *>(m_names), static_cast<ChartDataSource *>(m_colors)}) {
+            Q_EMIT source->itemsInserted(otherIndex, 1);
+            Q_EMIT source->dataChanged();
+        }
+    }
+}
+
+bool TopNProxySource::isAboveSelection(int index, qreal value) const
+{
+    // Until all items are selected, any new item is.
+    if (int(m_selection.size()) < m_count) {
+        return true;
+    }
+
+    if (m_selection.empty()) {
+        return false;
+    }
+
+    const auto smallest = m_selection.back();
+    return isLarger(value, index, m_sourceValues[smallest], smallest);
+}
+
+bool TopNProxySource::hasOther() const
+{
+    return m_sourceValues.size() > m_selection.size();
+}
+
+#include "moc_TopNProxySource.cpp"
@@ -0,0 +1,197 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 KQuickCharts Contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#ifndef TOPNPROXYSOURCE_H
+#define TOPNPROXYSOURCE_H
+
+#include <vector>
+
+#include <QColor>
+
+#include "ChartDataSource.h"
+
+class TopNProxySource;
+
+/**
+ * The names or colors matching the items of a TopNProxySource.
+ *
+ * \see TopNProxySource::names
+ * \see TopNProxySource::colors
+ */
+class QUICKCHARTS_EXPORT TopNCompanionSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Provided by TopNProxySource")
+
+public:
+    enum Role {
+        Names,
+        Colors,
+    };
+
+    TopNCompanionSource(TopNProxySource *proxy, Role role);
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+
+private:
+    TopNProxySource *m_proxy;
+    Role m_role;
+};
+
+/**
+ * A data source that provides the largest items of a different data source,
+ * with the remaining items combined into a single item.
+ *
+ * This provides the \ref count largest items of \ref source, largest first,
+ * followed by an item containing the sum of all other items, if there are any.
+ * This is intended for charts of many items where only the largest are of
+ * interest, like a pie chart of the memory usage of all processes. Items with
+ * the same value are ordered by their index, so the order does not change
+ * unless values do.
+ *
+ * The names and colors of the items of \ref nameSource and \ref colorSource
+ * are provided in the same order by \ref names and \ref colors, which can be
+ * used as name and color source of a chart.
+ *
+ * \code{.qml}
+ * TopNProxySource {
+ *     id: topProcesses
+ *     source: memorySource
+ *     nameSource: processNameSource
+ *     colorSource: processColorSource
+ *     count: 8
+ * }
+ *
+ * PieChart {
+ *     valueSources: topProcesses
+ *     nameSource: topProcesses.names
+ *     colorSource: topProcesses.colors
+ * }
+ * \endcode
+ *
+ * The largest items are selected in linear time, after which only they are
+ * sorted. Changing or appending items that remain smaller than the largest
+ * items only updates the sum of the other items.
+ */
+class QUICKCHARTS_EXPORT TopNProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit TopNProxySource(QObject *parent = nullptr);
+
+    /**
+     * The data source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
+    /**
+     * A data source with a name for each item of \ref source.
+     */
+    Q_PROPERTY(ChartDataSource *nameSource READ nameSource WRITE setNameSource NOTIFY nameSourceChanged)
+    ChartDataSource *nameSource() const;
+    void setNameSource(ChartDataSource *newNameSource);
+    Q_SIGNAL void nameSourceChanged();
+
+    /**
+     * A data source with a color for each item of \ref source.
+     */
+    Q_PROPERTY(ChartDataSource *colorSource READ colorSource WRITE setColorSource NOTIFY colorSourceChanged)
+    ChartDataSource *colorSource() const;
+    void setColorSource(ChartDataSource *newColorSource);
+    Q_SIGNAL void colorSourceChanged();
+
+    /**
+     * The number of largest items to provide.
+     *
+     * Defaults to 10.
+     */
+    Q_PROPERTY(int count READ count WRITE setCount NOTIFY countChanged)
+    int count() const;
+    void setCount(int newCount);
+    Q_SIGNAL void countChanged();
+
+    /**
+     * The name of the item combining all other items.
+     *
+     * Defaults to "Other".
+     */
+    Q_PROPERTY(QString otherName READ otherName WRITE setOtherName NOTIFY otherNameChanged)
+    QString otherName() const;
+    void setOtherName(const QString &newOtherName);
+    Q_SIGNAL void otherNameChanged();
+
+    /**
+     * The color of the item combining all other items.
+     *
+     * Defaults to gray.
+     */
+    Q_PROPERTY(QColor otherColor READ otherColor WRITE setOtherColor NOTIFY otherColorChanged)
+    QColor otherColor() const;
+    void setOtherColor(const QColor &newOtherColor);
+    Q_SIGNAL void otherColorChanged();
+
+    /**
+     * The names of the items, taken from \ref nameSource.
+     */
+    Q_PROPERTY(ChartDataSource *names READ names CONSTANT)
+    ChartDataSource *names() const;
+
+    /**
+     * The colors of the items, taken from \ref colorSource.
+     */
+    Q_PROPERTY(ChartDataSource *colors READ colors CONSTANT)
+    ChartDataSource *colors() const;
+
+    /**
+     * The index in \ref source of item \p index, or -1 for the item combining
+     * all other items.
+     */
+    Q_INVOKABLE int sourceIndex(int index) const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    friend class TopNCompanionSource;
+
+    void update();
+    void onSourceDataChanged();
+    bool isAboveSelection(int index, qreal value) const;
+    bool hasOther() const;
+
+    ChartDataSource *m_source = nullptr;
+    ChartDataSource *m_nameSource = nullptr;
+    ChartDataSource *m_colorSource = nullptr;
+    int m_count = 10;
+    QString m_otherName = QStringLiteral("Other");
+    QColor m_otherColor = Qt::gray;
+
+    TopNCompanionSource *m_names;
+    TopNCompanionSource *m_colors;
+
+    // A copy of the items of the source, to determine how changes affect
+    // the sum of the other items.
+    std::vector<qreal> m_sourceValues;
+    // The indices of the largest items, largest first.
+    std::vector<int> m_selection;
+    std::vector<bool> m_selected;
+    qreal m_otherSum = 0.0;
+};
+
+#endif // TOPNPROXYSOURCE_H